@@ -0,0 +1,173 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#if defined(__linux__)
+
+#include <benchmark/benchmark.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <dlgr/async_log_sink.h>
+
+// Log records written to a file on tmpfs. The append benchmarks measure what a producer pays per
+// record, against a write() per record, the drain benchmarks how fast the background thread gets
+// the records of several producers into the file.
+
+namespace {
+
+using dlgr::async_log_block_t;
+using dlgr::async_log_drop_t;
+using dlgr::async_log_overwrite_t;
+using dlgr::async_log_sink;
+
+constexpr auto record = std::string_view(
+    "2023-11-02T12:34:56.789012Z INFO  worker-7 request served in 42us\n");
+constexpr auto ring_capacity = std::size_t{1} << 20U;
+
+// Truncated every so often, so the benchmarks do not fill the memory
+constexpr auto truncate_every = std::int64_t{1} << 16U;
+
+// Unlinked file on tmpfs opened for appending, closed on destruction
+class tmpfs_file {
+ public:
+  tmpfs_file() {
+    auto path = std::string("/dev/shm/dlgr_bm_async_log_sink_XXXXXX");
+    fd_ = ::mkstemp(path.data());
+    if (fd_ >= 0) {
+      ::unlink(path.c_str());
+      ::fcntl(fd_, F_SETFL, O_APPEND);
+    }
+  }
+
+  tmpfs_file(const tmpfs_file&) = delete;
+  tmpfs_file(tmpfs_file&&) = delete;
+
+  ~tmpfs_file() noexcept {
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+  }
+
+  auto operator=(const tmpfs_file&) -> tmpfs_file& = delete;
+  auto operator=(tmpfs_file&&) -> tmpfs_file& = delete;
+
+  [[nodiscard]] auto fd() const noexcept -> int { return fd_; }
+
+  auto truncate() const -> void {
+    if (::ftruncate(fd_, 0) != 0) {
+      throw std::system_error(errno, std::system_category(), "ftruncate");
+    }
+  }
+
+ private:
+  int fd_ = -1;
+};
+
+// == Producer latency
+
+void bm_log_write_append(benchmark::State& state) {
+  const auto file = tmpfs_file();
+  if (file.fd() < 0) {
+    state.SkipWithError("no tmpfs at /dev/shm");
+    return;
+  }
+
+  auto count = std::int64_t{0};
+  for ([[maybe_unused]] auto iter : state) {
+    benchmark::DoNotOptimize(::write(file.fd(), record.data(), record.size()));
+    if (++count % truncate_every == 0) {
+      state.PauseTiming();
+      file.truncate();
+      state.ResumeTiming();
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <class OverflowPolicy>
+void bm_async_log_sink_append(benchmark::State& state) {
+  const auto file = tmpfs_file();
+  if (file.fd() < 0) {
+    state.SkipWithError("no tmpfs at /dev/shm");
+    return;
+  }
+  auto sink = async_log_sink<OverflowPolicy>(file.fd(), ring_capacity);
+  auto producer = sink.make_producer();
+
+  auto count = std::int64_t{0};
+  for ([[maybe_unused]] auto iter : state) {
+    benchmark::DoNotOptimize(producer.append(record));
+    if (++count % truncate_every == 0) {
+      state.PauseTiming();
+      sink.flush();
+      file.truncate();
+      state.ResumeTiming();
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.counters["dropped"] = static_cast<double>(sink.dropped());
+}
+
+// == Drain throughput
+
+void bm_async_log_sink_drain(benchmark::State& state) {
+  const auto file = tmpfs_file();
+  if (file.fd() < 0) {
+    state.SkipWithError("no tmpfs at /dev/shm");
+    return;
+  }
+  auto sink = async_log_sink<async_log_block_t>(file.fd(), ring_capacity);
+
+  const auto producers_count = static_cast<std::size_t>(state.range(0));
+  auto producers = std::vector<async_log_sink<async_log_block_t>::producer>();
+  for (auto idx = std::size_t{0}; idx < producers_count; ++idx) {
+    producers.push_back(sink.make_producer());
+  }
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto threads = std::vector<std::thread>();
+    for (auto& producer : producers) {
+      threads.emplace_back([&producer] {
+        for (auto idx = std::int64_t{0}; idx < truncate_every; ++idx) {
+          producer.append(record);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    sink.flush();
+
+    state.PauseTiming();
+    file.truncate();
+    state.ResumeTiming();
+  }
+
+  const auto records = state.iterations() * truncate_every * state.range(0);
+  state.SetItemsProcessed(records);
+  state.SetBytesProcessed(records * static_cast<std::int64_t>(record.size()));
+}
+
+}  // namespace
+
+// NOLINTBEGIN
+BENCHMARK(bm_log_write_append);
+BENCHMARK_TEMPLATE(bm_async_log_sink_append, async_log_drop_t);
+BENCHMARK_TEMPLATE(bm_async_log_sink_append, async_log_block_t);
+BENCHMARK_TEMPLATE(bm_async_log_sink_append, async_log_overwrite_t);
+BENCHMARK(bm_async_log_sink_drain)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+// NOLINTEND
+
+#endif  // defined(__linux__)
@@ -2,12 +2,28 @@
 
 #include <benchmark/benchmark.h>
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <memory>
 #include <mutex>
+#include <numeric>
+#include <ranges>
 #include <semaphore>
 #include <shared_mutex>
+#include <span>
 #include <thread>
+#include <vector>
+
+#include <dlgr/broadcast_ring.h>
+#include <dlgr/mpmc_ring.h>
+#include <dlgr/ring_view.h>
+#include <dlgr/round_robin.h>
+#include <dlgr/spsc_ring.h>
 
 namespace {
 
@@ -175,6 +191,429 @@ void bm_concurrent_flag(benchmark::State& state) {
   other_thread.join();
 }
 
+constexpr auto spsc_capacity = std::size_t{1024};
+constexpr auto spsc_batch_size = std::size_t{64};
+constexpr auto spsc_stop = std::numeric_limits<std::uint64_t>::max();
+
+void bm_concurrent_spsc_ring(benchmark::State& state) {
+  auto ring = dlgr::spsc_ring<std::uint64_t>(spsc_capacity);
+  auto sum = std::uint64_t{0};
+
+  auto other_thread = std::thread([&] {
+    while (true) {
+      const auto value = ring.try_pop();
+      if (!value) {
+        std::this_thread::yield();
+        continue;
+      }
+      if (*value == spsc_stop) {
+        return;
+      }
+      sum += *value;
+    }
+  });
+
+  auto value = std::uint64_t{0};
+  for ([[maybe_unused]] auto iter : state) {
+    while (!ring.try_push(value)) {
+      std::this_thread::yield();
+    }
+    ++value;
+  }
+
+  while (!ring.try_push(spsc_stop)) {
+    std::this_thread::yield();
+  }
+
+  other_thread.join();
+
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations());
+}
+
+void bm_concurrent_spsc_ring_wait(benchmark::State& state) {
+  auto ring = dlgr::spsc_ring<std::uint64_t>(spsc_capacity);
+  auto sum = std::uint64_t{0};
+
+  auto other_thread = std::thread([&] {
+    for (auto value = ring.pop(); value != spsc_stop; value = ring.pop()) {
+      sum += value;
+    }
+  });
+
+  auto value = std::uint64_t{0};
+  for ([[maybe_unused]] auto iter : state) {
+    ring.push(value++);
+  }
+
+  ring.push(spsc_stop);
+
+  other_thread.join();
+
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations());
+}
+
+void bm_concurrent_spsc_ring_bulk(benchmark::State& state) {
+  auto ring = dlgr::spsc_ring<std::uint64_t>(spsc_capacity);
+  auto sum = std::uint64_t{0};
+
+  auto other_thread = std::thread([&] {
+    auto batch = std::array<std::uint64_t, spsc_batch_size>{};
+    while (true) {
+      const auto count = ring.pop_bulk(batch);
+      if (count == 0) {
+        std::this_thread::yield();
+        continue;
+      }
+      for (auto value : std::span(batch).first(count)) {
+        if (value == spsc_stop) {
+          return;
+        }
+        sum += value;
+      }
+    }
+  });
+
+  auto batch = std::array<std::uint64_t, spsc_batch_size>{};
+  for ([[maybe_unused]] auto iter : state) {
+    auto pending = std::span<const std::uint64_t>(batch);
+    while (!pending.empty()) {
+      const auto count = ring.push_bulk(pending);
+      if (count == 0) {
+        std::this_thread::yield();
+      }
+      pending = pending.subspan(count);
+    }
+    for (auto& value : batch) {
+      value += spsc_batch_size;
+    }
+  }
+
+  while (!ring.try_push(spsc_stop)) {
+    std::this_thread::yield();
+  }
+
+  other_thread.join();
+
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(spsc_batch_size));
+}
+
+constexpr auto mpmc_capacity = std::size_t{1024};
+constexpr auto mpmc_items = std::size_t{1} << 16U;
+
+// Bounded queue guarded by a mutex, the baseline for mpmc_ring
+template <class ValueType>
+class locked_queue {
+ public:
+  explicit locked_queue(std::size_t capacity) : capacity_(capacity) {}
+
+  auto push(ValueType value) -> void {
+    auto lock = std::unique_lock(mutex_);
+    not_full_.wait(lock, [&] { return items_.size() < capacity_; });
+    items_.push_back(value);
+    lock.unlock();
+    not_empty_.notify_one();
+  }
+
+  auto pop() -> ValueType {
+    auto lock = std::unique_lock(mutex_);
+    not_empty_.wait(lock, [&] { return !items_.empty(); });
+    auto value = items_.front();
+    items_.pop_front();
+    lock.unlock();
+    not_full_.notify_one();
+    return value;
+  }
+
+ private:
+  std::size_t capacity_ = 0;
+  std::mutex mutex_ = {};
+  std::condition_variable not_full_ = {};
+  std::condition_variable not_empty_ = {};
+  std::deque<ValueType> items_ = {};
+};
+
+// Every iteration moves mpmc_items messages from range(0) producers to range(1) consumers
+template <class QueueType>
+void bm_concurrent_mpmc(benchmark::State& state) {
+  const auto n_producers = static_cast<std::size_t>(state.range(0));
+  const auto n_consumers = static_cast<std::size_t>(state.range(1));
+  const auto per_producer = mpmc_items / n_producers;
+  const auto per_consumer = per_producer * n_producers / n_consumers;
+
+  auto queue = QueueType(mpmc_capacity);
+  auto sum = std::atomic<std::uint64_t>(0);
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto threads = std::vector<std::thread>();
+    threads.reserve(n_producers + n_consumers);
+
+    for (auto producer = std::size_t{0}; producer < n_producers; ++producer) {
+      threads.emplace_back([&queue, per_producer] {
+        for (auto value = std::uint64_t{0}; value < per_producer; ++value) {
+          queue.push(value);
+        }
+      });
+    }
+    for (auto consumer = std::size_t{0}; consumer < n_consumers; ++consumer) {
+      threads.emplace_back([&queue, &sum, per_consumer] {
+        auto local_sum = std::uint64_t{0};
+        for (auto count = std::size_t{0}; count < per_consumer; ++count) {
+          local_sum += queue.pop();
+        }
+        sum.fetch_add(local_sum, std::memory_order::relaxed);
+      });
+    }
+
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  benchmark::DoNotOptimize(sum.load());
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(mpmc_items));
+}
+
+void bm_concurrent_mpmc_ring(benchmark::State& state) {
+  bm_concurrent_mpmc<dlgr::mpmc_ring<std::uint64_t>>(state);
+}
+
+void bm_concurrent_mpmc_mutex(benchmark::State& state) {
+  bm_concurrent_mpmc<locked_queue<std::uint64_t>>(state);
+}
+
+void mpmc_args(benchmark::internal::Benchmark* bench) {
+  for (auto producers : {1, 2, 4, 8}) {
+    for (auto consumers : {1, 2, 4, 8}) {
+      bench->Args({producers, consumers});
+    }
+  }
+  bench->ArgNames({"producers", "consumers"})->UseRealTime();
+}
+
+constexpr auto broadcast_capacity = std::size_t{1024};
+constexpr auto broadcast_batch_size = std::size_t{64};
+constexpr auto broadcast_events = std::size_t{1} << 16U;
+
+// Every iteration delivers broadcast_events events to each of range(0) consumers through one
+// broadcast_ring, in batches claimed and published at once
+void bm_concurrent_broadcast_ring(benchmark::State& state) {
+  const auto n_consumers = static_cast<std::size_t>(state.range(0));
+  auto ring = dlgr::broadcast_ring<std::uint64_t>(broadcast_capacity, n_consumers);
+  auto sum = std::atomic<std::uint64_t>(0);
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto threads = std::vector<std::thread>();
+    threads.reserve(n_consumers);
+
+    for (auto consumer = std::size_t{0}; consumer < n_consumers; ++consumer) {
+      threads.emplace_back([&sum, reader = ring.make_consumer(consumer)]() mutable {
+        auto local_sum = std::uint64_t{0};
+        for (auto received = std::size_t{0}; received < broadcast_events;) {
+          const auto batch = reader.available();
+          if (batch.empty()) {
+            std::this_thread::yield();
+            continue;
+          }
+          for (auto value : batch) {
+            local_sum += value;
+          }
+          received += batch.size();
+          reader.release(batch.size());
+        }
+        sum.fetch_add(local_sum, std::memory_order::relaxed);
+      });
+    }
+
+    for (auto value = std::uint64_t{0}; value < broadcast_events;) {
+      auto slots = ring.try_claim(broadcast_batch_size);
+      if (slots.empty()) {
+        std::this_thread::yield();
+        continue;
+      }
+      for (auto& slot : slots) {
+        slot = value++;
+      }
+      ring.publish(slots.size());
+    }
+
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  benchmark::DoNotOptimize(sum.load());
+  state.SetItemsProcessed(state.iterations()
+                          * static_cast<std::int64_t>(broadcast_events * n_consumers));
+}
+
+// The same with every batch copied into one spsc_ring per consumer, the baseline
+void bm_concurrent_broadcast_spsc(benchmark::State& state) {
+  const auto n_consumers = static_cast<std::size_t>(state.range(0));
+  auto rings = std::vector<std::unique_ptr<dlgr::spsc_ring<std::uint64_t>>>();
+  for (auto consumer = std::size_t{0}; consumer < n_consumers; ++consumer) {
+    rings.push_back(std::make_unique<dlgr::spsc_ring<std::uint64_t>>(broadcast_capacity));
+  }
+  auto sum = std::atomic<std::uint64_t>(0);
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto threads = std::vector<std::thread>();
+    threads.reserve(n_consumers);
+
+    for (auto& ring : rings) {
+      threads.emplace_back([&sum, &ring = *ring] {
+        auto batch = std::array<std::uint64_t, broadcast_batch_size>{};
+        auto local_sum = std::uint64_t{0};
+        for (auto received = std::size_t{0}; received < broadcast_events;) {
+          const auto count = ring.pop_bulk(batch);
+          if (count == 0) {
+            std::this_thread::yield();
+            continue;
+          }
+          for (auto value : std::span(batch).first(count)) {
+            local_sum += value;
+          }
+          received += count;
+        }
+        sum.fetch_add(local_sum, std::memory_order::relaxed);
+      });
+    }
+
+    auto batch = std::array<std::uint64_t, broadcast_batch_size>{};
+    std::iota(batch.begin(), batch.end(), std::uint64_t{0});
+    for (auto sent = std::size_t{0}; sent < broadcast_events; sent += broadcast_batch_size) {
+      for (auto& ring : rings) {
+        auto pending = std::span<const std::uint64_t>(batch);
+        while (!pending.empty()) {
+          const auto count = ring->push_bulk(pending);
+          if (count == 0) {
+            std::this_thread::yield();
+          }
+          pending = pending.subspan(count);
+        }
+      }
+      for (auto& value : batch) {
+        value += broadcast_batch_size;
+      }
+    }
+
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  benchmark::DoNotOptimize(sum.load());
+  state.SetItemsProcessed(state.iterations()
+                          * static_cast<std::int64_t>(broadcast_events * n_consumers));
+}
+
+void broadcast_args(benchmark::internal::Benchmark* bench) {
+  bench->Arg(1)->Arg(2)->Arg(4)->Arg(8)->ArgName("consumers")->UseRealTime();
+}
+
+constexpr auto round_robin_backends = std::size_t{12};
+constexpr auto round_robin_turns = std::size_t{1} << 16U;
+
+// Unbounded ring_view walked under a mutex, the baseline for round_robin
+class locked_round_robin {
+ public:
+  explicit locked_round_robin(const std::vector<std::uint64_t>& backends)
+      : ring_(backends), cursor_(ring_.begin()) {}
+
+  auto next() -> std::uint64_t {
+    auto lock = std::unique_lock(mutex_);
+    const auto value = *cursor_;
+    ++cursor_;
+    return value;
+  }
+
+  auto next_batch(std::size_t count) {
+    auto lock = std::unique_lock(mutex_);
+    const auto first = cursor_;
+    cursor_ += static_cast<std::ptrdiff_t>(count);
+    return std::views::counted(first, static_cast<std::ptrdiff_t>(count));
+  }
+
+ private:
+  using base_type = std::ranges::ref_view<const std::vector<std::uint64_t>>;
+  using ring_type = dlgr::ranges::ring_view<base_type>;
+
+  ring_type ring_;
+  std::ranges::iterator_t<ring_type> cursor_;
+  std::mutex mutex_ = {};
+};
+
+// Every iteration takes round_robin_turns turns split between range(0) threads, range(1) at a time
+template <class DispenserType>
+void bm_concurrent_round_robin(benchmark::State& state, DispenserType& dispenser) {
+  const auto n_threads = static_cast<std::size_t>(state.range(0));
+  const auto batch = static_cast<std::size_t>(state.range(1));
+  const auto per_thread = round_robin_turns / n_threads;
+
+  auto sum = std::atomic<std::uint64_t>(0);
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto threads = std::vector<std::thread>();
+    threads.reserve(n_threads);
+
+    for (auto thread = std::size_t{0}; thread < n_threads; ++thread) {
+      threads.emplace_back([&dispenser, &sum, per_thread, batch] {
+        auto local_sum = std::uint64_t{0};
+        for (auto turn = std::size_t{0}; turn < per_thread; turn += batch) {
+          if (batch == 1) {
+            local_sum += dispenser.next();
+            continue;
+          }
+          for (auto backend : dispenser.next_batch(batch)) {
+            local_sum += backend;
+          }
+        }
+        sum.fetch_add(local_sum, std::memory_order::relaxed);
+      });
+    }
+
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  benchmark::DoNotOptimize(sum.load());
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(round_robin_turns));
+}
+
+auto make_backends() -> std::vector<std::uint64_t> {
+  auto backends = std::vector<std::uint64_t>(round_robin_backends);
+  std::iota(backends.begin(), backends.end(), std::uint64_t{0});
+  return backends;
+}
+
+void bm_concurrent_round_robin_mutex(benchmark::State& state) {
+  const auto backends = make_backends();
+  auto dispenser = locked_round_robin(backends);
+  bm_concurrent_round_robin(state, dispenser);
+}
+
+void bm_concurrent_round_robin_atomic(benchmark::State& state) {
+  const auto backends = make_backends();
+  auto dispenser = dlgr::round_robin(backends);
+  bm_concurrent_round_robin(state, dispenser);
+}
+
+void bm_concurrent_round_robin_weighted(benchmark::State& state) {
+  const auto backends = make_backends();
+  auto weights = std::vector<std::size_t>(round_robin_backends);
+  std::iota(weights.begin(), weights.end(), std::size_t{1});
+  auto dispenser = dlgr::weighted_round_robin(backends, weights);
+  bm_concurrent_round_robin(state, dispenser);
+}
+
+// Threads, batch size
+void round_robin_args(benchmark::internal::Benchmark* bench) {
+  bench->ArgsProduct({{1, 2, 4, 8}, {1, 16}})->ArgNames({"threads", "batch"})->UseRealTime();
+}
+
 }  // namespace
 
 // NOLINTBEGIN
@@ -183,4 +622,14 @@ BENCHMARK(bm_concurrent_condvar_mutex);
 BENCHMARK(bm_concurrent_semaphore);
 BENCHMARK(bm_concurrent_atomic);
 BENCHMARK(bm_concurrent_flag);
+BENCHMARK(bm_concurrent_spsc_ring);
+BENCHMARK(bm_concurrent_spsc_ring_wait);
+BENCHMARK(bm_concurrent_spsc_ring_bulk);
+BENCHMARK(bm_concurrent_mpmc_ring)->Apply(mpmc_args);
+BENCHMARK(bm_concurrent_mpmc_mutex)->Apply(mpmc_args);
+BENCHMARK(bm_concurrent_broadcast_ring)->Apply(broadcast_args);
+BENCHMARK(bm_concurrent_broadcast_spsc)->Apply(broadcast_args);
+BENCHMARK(bm_concurrent_round_robin_mutex)->Apply(round_robin_args);
+BENCHMARK(bm_concurrent_round_robin_atomic)->Apply(round_robin_args);
+BENCHMARK(bm_concurrent_round_robin_weighted)->Apply(round_robin_args);
 // NOLINTEND
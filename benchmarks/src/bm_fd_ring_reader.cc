@@ -0,0 +1,191 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#if defined(__linux__)
+
+#include <benchmark/benchmark.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <span>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <dlgr/fd_ring_reader.h>
+
+// Length-prefixed frames read from a descriptor, with the payload bytes summed as the "parse" step.
+// The ring reader hands out frames in place, the baseline reads into a vector chunk, appends it to
+// the pending bytes and copies every frame out before looking at it.
+
+namespace {
+
+using dlgr::fd_ring_reader;
+
+constexpr auto stream_size = std::size_t{4} << 20U;
+constexpr auto chunk_size = std::size_t{64} << 10U;
+
+// Frames of 16 to 512 bytes with a little-endian 32-bit prefix
+auto make_stream() -> std::vector<std::byte> {
+  auto engine = std::mt19937(42);  // NOLINT(cert-msc32-c,cert-msc51-cpp): Reproducible
+  auto dist = std::uniform_int_distribution<std::uint32_t>(16, 512);
+  auto out = std::vector<std::byte>();
+  while (out.size() < stream_size) {
+    const auto length = dist(engine);
+    for (auto shift = 0U; shift < 32U; shift += 8U) {
+      out.push_back(static_cast<std::byte>(length >> shift));
+    }
+    for (auto idx = std::uint32_t{0}; idx < length; ++idx) {
+      out.push_back(static_cast<std::byte>(idx * 7U));
+    }
+  }
+  return out;
+}
+
+[[noreturn]] void throw_errno(const char* what) {
+  throw std::system_error(errno, std::system_category(), what);
+}
+
+void write_all(int fd, std::span<const std::byte> bytes) {
+  while (!bytes.empty()) {
+    const auto written = ::write(fd, bytes.data(), std::min(bytes.size(), chunk_size));
+    if (written < 0) {
+      throw_errno("write");
+    }
+    bytes = bytes.subspan(static_cast<std::size_t>(written));
+  }
+}
+
+template <std::ranges::range BytesType>
+auto checksum(const BytesType& bytes) -> std::uint32_t {
+  auto sum = std::uint32_t{0};
+  for (auto byte : bytes) {
+    sum += std::to_integer<std::uint32_t>(byte);
+  }
+  return sum;
+}
+
+// == Consumers
+
+auto consume_ring(int fd) -> std::uint32_t {
+  auto reader = fd_ring_reader(fd, chunk_size);
+  auto sum = std::uint32_t{0};
+  while (true) {
+    const auto frame = reader.next_frame<std::uint32_t>();
+    if (!frame) {
+      if (reader.eof()) {
+        return sum;
+      }
+      reader.fill();
+      continue;
+    }
+    if (const auto span = frame->contiguous()) {
+      sum += checksum(*span);
+    } else {
+      sum += checksum(frame->bytes());
+    }
+    reader.release(*frame);
+  }
+}
+
+auto consume_vector(int fd) -> std::uint32_t {
+  auto chunk = std::vector<std::byte>(chunk_size);
+  auto pending = std::vector<std::byte>();
+  auto sum = std::uint32_t{0};
+  while (true) {
+    const auto bytes = ::read(fd, chunk.data(), chunk.size());
+    if (bytes < 0) {
+      throw_errno("read");
+    }
+    if (bytes == 0) {
+      return sum;
+    }
+    pending.insert(pending.end(), chunk.begin(), chunk.begin() + bytes);
+
+    auto offset = std::size_t{0};
+    while (pending.size() - offset >= 4) {
+      auto length = std::uint32_t{0};
+      for (auto idx = 0U; idx < 4U; ++idx) {
+        length |= std::to_integer<std::uint32_t>(pending[offset + idx]) << (idx * 8U);
+      }
+      if (pending.size() - offset - 4 < length) {
+        break;
+      }
+      const auto first = pending.begin() + static_cast<std::ptrdiff_t>(offset + 4);
+      const auto payload = std::vector<std::byte>(first, first + length);
+      sum += checksum(payload);
+      offset += 4 + length;
+    }
+    pending.erase(pending.begin(), pending.begin() + static_cast<std::ptrdiff_t>(offset));
+  }
+}
+
+using consumer_type = std::uint32_t (*)(int);
+
+// == Local pipe
+
+template <consumer_type Consumer>
+void bm_fd_ring_reader_pipe(benchmark::State& state) {
+  const auto stream = make_stream();
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto fds = std::array<int, 2>{};
+    if (::pipe(fds.data()) != 0) {
+      throw_errno("pipe");
+    }
+    auto writer = std::thread([&] {
+      write_all(fds[1], stream);
+      ::close(fds[1]);
+    });
+    benchmark::DoNotOptimize(Consumer(fds[0]));
+    writer.join();
+    ::close(fds[0]);
+  }
+
+  state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(stream.size()));
+}
+
+// == File on tmpfs
+
+template <consumer_type Consumer>
+void bm_fd_ring_reader_tmpfs(benchmark::State& state) {
+  const auto stream = make_stream();
+
+  auto path = std::string("/dev/shm/dlgr_bm_fd_ring_reader_XXXXXX");
+  const auto fd = ::mkstemp(path.data());
+  if (fd < 0) {
+    state.SkipWithError("no tmpfs at /dev/shm");
+    return;
+  }
+  ::unlink(path.c_str());
+  write_all(fd, stream);
+
+  for ([[maybe_unused]] auto iter : state) {
+    if (::lseek(fd, 0, SEEK_SET) != 0) {
+      throw_errno("lseek");
+    }
+    benchmark::DoNotOptimize(Consumer(fd));
+  }
+  ::close(fd);
+
+  state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(stream.size()));
+}
+
+}  // namespace
+
+// NOLINTBEGIN
+BENCHMARK_TEMPLATE(bm_fd_ring_reader_pipe, consume_ring)->UseRealTime();
+BENCHMARK_TEMPLATE(bm_fd_ring_reader_pipe, consume_vector)->UseRealTime();
+BENCHMARK_TEMPLATE(bm_fd_ring_reader_tmpfs, consume_ring);
+BENCHMARK_TEMPLATE(bm_fd_ring_reader_tmpfs, consume_vector);
+// NOLINTEND
+
+#endif  // defined(__linux__)
@@ -0,0 +1,145 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory_resource>
+#include <random>
+#include <vector>
+
+#include <dlgr/ring_arena.h>
+
+// Messages of 16..512 bytes passing through a pipeline: the producer allocates and fills one per
+// iteration, the consumer reads and frees the oldest once range(0) messages are in flight. With
+// range(1) set, every eighth message is freed out of order, as a slow consumer would.
+
+namespace {
+
+constexpr auto arena_capacity = std::size_t{1} << 22U;
+
+struct message {
+  std::byte* data = nullptr;
+  std::size_t size = 0;
+};
+
+auto make_sizes() -> std::vector<std::size_t> {
+  auto gen = std::mt19937(42);
+  auto dist = std::uniform_int_distribution<std::size_t>(16, 512);
+  auto out = std::vector<std::size_t>(4096);
+  for (auto& size : out) {
+    size = dist(gen);
+  }
+  return out;
+}
+
+struct new_delete_allocator {
+  static auto allocate(std::size_t size) -> std::byte* { return new std::byte[size]; }
+
+  static auto deallocate(std::byte* data, [[maybe_unused]] std::size_t size) -> void {
+    delete[] data;
+  }
+};
+
+class pmr_allocator {
+ public:
+  explicit pmr_allocator(std::pmr::memory_resource& resource) : resource_(&resource) {}
+
+  auto allocate(std::size_t size) -> std::byte* {
+    return static_cast<std::byte*>(resource_->allocate(size));
+  }
+
+  auto deallocate(std::byte* data, std::size_t size) -> void { resource_->deallocate(data, size); }
+
+ private:
+  std::pmr::memory_resource* resource_;
+};
+
+class arena_allocator {
+ public:
+  explicit arena_allocator(dlgr::ring_arena& arena) : arena_(&arena) {}
+
+  auto allocate(std::size_t size) -> std::byte* {
+    return static_cast<std::byte*>(arena_->allocate(size));
+  }
+
+  auto deallocate(std::byte* data, [[maybe_unused]] std::size_t size) -> void {
+    arena_->deallocate(data);
+  }
+
+ private:
+  dlgr::ring_arena* arena_;
+};
+
+template <class AllocatorType>
+void bm_ring_arena_messages(benchmark::State& state, AllocatorType allocator) {
+  const auto in_flight = static_cast<std::size_t>(state.range(0));
+  const auto out_of_order = state.range(1) != 0;
+  const auto sizes = make_sizes();
+
+  auto queue = std::deque<message>();
+  auto checksum = std::uint64_t{0};
+  auto consume = [&](std::size_t index) {
+    const auto msg = queue[index];
+    queue.erase(queue.begin() + static_cast<std::ptrdiff_t>(index));
+    checksum += static_cast<std::uint64_t>(msg.data[0]);
+    checksum += static_cast<std::uint64_t>(msg.data[msg.size - 1]);
+    allocator.deallocate(msg.data, msg.size);
+  };
+
+  auto count = std::size_t{0};
+  for ([[maybe_unused]] auto iter : state) {
+    const auto size = sizes[count % sizes.size()];
+    auto* data = allocator.allocate(size);
+    std::memset(data, static_cast<int>(count), size);
+    queue.push_back({data, size});
+
+    if (queue.size() > in_flight) {
+      consume(out_of_order && count % 8 == 0 ? 1 : 0);
+    }
+    ++count;
+  }
+
+  while (!queue.empty()) {
+    consume(0);
+  }
+
+  benchmark::DoNotOptimize(checksum);
+  state.SetItemsProcessed(state.iterations());
+}
+
+void bm_ring_arena_new_delete(benchmark::State& state) {
+  bm_ring_arena_messages(state, new_delete_allocator());
+}
+
+void bm_ring_arena_pool_resource(benchmark::State& state) {
+  auto resource = std::pmr::unsynchronized_pool_resource();
+  bm_ring_arena_messages(state, pmr_allocator(resource));
+}
+
+void bm_ring_arena_arena(benchmark::State& state) {
+  auto arena = dlgr::ring_arena(arena_capacity);
+  bm_ring_arena_messages(state, arena_allocator(arena));
+}
+
+void bm_ring_arena_arena_resource(benchmark::State& state) {
+  auto arena = dlgr::ring_arena(arena_capacity);
+  auto resource = dlgr::ring_arena_resource(arena);
+  bm_ring_arena_messages(state, pmr_allocator(resource));
+}
+
+// Messages in flight, out of order frees
+void messages_args(benchmark::internal::Benchmark* bench) {
+  bench->ArgsProduct({{16, 1024}, {0, 1}})->ArgNames({"in_flight", "out_of_order"});
+}
+
+}  // namespace
+
+// NOLINTBEGIN
+BENCHMARK(bm_ring_arena_new_delete)->Apply(messages_args);
+BENCHMARK(bm_ring_arena_pool_resource)->Apply(messages_args);
+BENCHMARK(bm_ring_arena_arena)->Apply(messages_args);
+BENCHMARK(bm_ring_arena_arena_resource)->Apply(messages_args);
+// NOLINTEND
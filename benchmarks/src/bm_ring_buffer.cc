@@ -0,0 +1,140 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include <dlgr/ring_buffer.h>
+
+#if defined(__linux__)
+#include <dlgr/mirrored_ring_buffer.h>
+#endif
+
+namespace {
+
+constexpr auto stream_capacity = std::size_t{4096};
+
+// Stands for a parser which needs its input as one contiguous block
+auto parse_record(std::span<const char> record) -> std::uint32_t {
+  return std::accumulate(record.begin(), record.end(), std::uint32_t{0},
+                         [](std::uint32_t hash, char chr) {
+                           return hash * 31U + static_cast<unsigned char>(chr);
+                         });
+}
+
+auto make_record(std::int64_t size) -> std::vector<char> {
+  auto out = std::vector<char>(static_cast<std::size_t>(size));
+  std::iota(out.begin(), out.end(), 'a');
+  return out;
+}
+
+void set_stream_counters(benchmark::State& state) {
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// Records which wrap around are stitched into a scratch buffer before parsing
+void bm_ring_buffer_stream_two_segments(benchmark::State& state) {
+  const auto record = make_record(state.range(0));
+  auto buf = dlgr::ring_buffer<char>(stream_capacity);
+  auto scratch = std::vector<char>(record.size());
+  auto hash = std::uint32_t{0};
+
+  for ([[maybe_unused]] auto iter : state) {
+    buf.push_n(record.begin(), record.size());
+
+    const auto spans = buf.as_spans();
+    if (spans[1].empty()) {
+      hash += parse_record(spans[0]);
+    } else {
+      auto out = std::copy(spans[0].begin(), spans[0].end(), scratch.begin());
+      std::copy(spans[1].begin(), spans[1].end(), out);
+      hash += parse_record(scratch);
+    }
+    buf.clear();
+  }
+
+  benchmark::DoNotOptimize(hash);
+  set_stream_counters(state);
+}
+
+#if defined(__linux__)
+void bm_ring_buffer_stream_mirrored(benchmark::State& state) {
+  const auto record = make_record(state.range(0));
+  auto buf = dlgr::mirrored_ring_buffer<char>(stream_capacity);
+  auto hash = std::uint32_t{0};
+
+  for ([[maybe_unused]] auto iter : state) {
+    buf.push_n(record);
+    hash += parse_record(buf.as_span());
+    buf.consume(buf.size());
+  }
+
+  benchmark::DoNotOptimize(hash);
+  set_stream_counters(state);
+}
+#endif
+
+void stream_args(benchmark::internal::Benchmark* bench) {
+  bench->Arg(61)->Arg(1000)->Arg(3000);
+}
+
+// == Iteration
+
+// Full buffer of range(0) elements, half of them past the seam. The capacity is not a power of
+// two, so a ring_view built per begin() or end() call would divide to find its lap length.
+auto make_full_buffer(std::int64_t size) -> dlgr::ring_buffer<std::int64_t> {
+  auto buf = dlgr::ring_buffer<std::int64_t>(static_cast<std::size_t>(size));
+  for (auto val = std::int64_t{0}; val < size + size / 2; ++val) {
+    if (buf.full()) {
+      buf.pop_front();
+    }
+    buf.push_back(val);
+  }
+  return buf;
+}
+
+// The plain loop, with end() called on every check
+void bm_ring_buffer_iterate_end_in_loop(benchmark::State& state) {
+  const auto buf = make_full_buffer(state.range(0));
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto sum = std::int64_t{0};
+    for (auto it = buf.begin(); it != buf.end(); ++it) {
+      sum += *it;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void bm_ring_buffer_iterate_end_hoisted(benchmark::State& state) {
+  const auto buf = make_full_buffer(state.range(0));
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto sum = std::int64_t{0};
+    for (auto it = buf.begin(), last = buf.end(); it != last; ++it) {
+      sum += *it;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+// NOLINTBEGIN
+BENCHMARK(bm_ring_buffer_stream_two_segments)->Apply(stream_args);
+#if defined(__linux__)
+BENCHMARK(bm_ring_buffer_stream_mirrored)->Apply(stream_args);
+#endif
+BENCHMARK(bm_ring_buffer_iterate_end_in_loop)->Arg(1000);
+BENCHMARK(bm_ring_buffer_iterate_end_hoisted)->Arg(1000);
+// NOLINTEND
@@ -0,0 +1,684 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <vector>
+#include <version>
+
+#include <dlgr/ring_algorithm.h>
+#include <dlgr/ring_parallel.h>
+#include <dlgr/ring_simd.h>
+#include <dlgr/ring_static.h>
+#include <dlgr/ring_stride.h>
+#include <dlgr/ring_view.h>
+#include <dlgr/ring_window.h>
+#include <dlgr/ring_zip.h>
+
+namespace {
+
+using dlgr::ranges::ring_view;
+
+auto make_floats(std::int64_t size) -> std::vector<float> {
+  auto out = std::vector<float>(static_cast<std::size_t>(size));
+  std::iota(out.begin(), out.end(), 0.0F);
+  return out;
+}
+
+void set_ring_counters(benchmark::State& state, std::size_t ring_size) {
+  const auto items = static_cast<std::int64_t>(ring_size) * state.iterations();
+  state.SetItemsProcessed(items);
+  state.SetBytesProcessed(items * static_cast<std::int64_t>(sizeof(float)));
+}
+
+void bm_ring_view_copy_iterator(benchmark::State& state) {
+  const auto base = make_floats(state.range(0));
+  const auto rng = ring_view(base, static_cast<std::size_t>(state.range(1)));
+  auto out = std::vector<float>(rng.size());
+
+  for ([[maybe_unused]] auto iter : state) {
+    std::ranges::copy(rng, out.begin());
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  set_ring_counters(state, rng.size());
+}
+
+void bm_ring_view_copy_segments(benchmark::State& state) {
+  const auto base = make_floats(state.range(0));
+  const auto rng = ring_view(base, static_cast<std::size_t>(state.range(1)));
+  auto out = std::vector<float>(rng.size());
+
+  for ([[maybe_unused]] auto iter : state) {
+    dlgr::ranges::copy(rng, out.begin());
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  set_ring_counters(state, rng.size());
+}
+
+void bm_ring_view_transform_iterator(benchmark::State& state) {
+  const auto base = make_floats(state.range(0));
+  const auto rng = ring_view(base, static_cast<std::size_t>(state.range(1)));
+  auto out = std::vector<float>(rng.size());
+
+  for ([[maybe_unused]] auto iter : state) {
+    std::ranges::transform(rng, out.begin(), [](float val) { return val * 2.0F + 1.0F; });
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  set_ring_counters(state, rng.size());
+}
+
+void bm_ring_view_transform_segments(benchmark::State& state) {
+  const auto base = make_floats(state.range(0));
+  const auto rng = ring_view(base, static_cast<std::size_t>(state.range(1)));
+  auto out = std::vector<float>(rng.size());
+
+  for ([[maybe_unused]] auto iter : state) {
+    dlgr::ranges::transform(rng, out.begin(), [](float val) { return val * 2.0F + 1.0F; });
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  set_ring_counters(state, rng.size());
+}
+
+void bm_ring_view_fill_iterator(benchmark::State& state) {
+  auto base = make_floats(state.range(0));
+  auto rng = ring_view(base, static_cast<std::size_t>(state.range(1)));
+
+  for ([[maybe_unused]] auto iter : state) {
+    std::ranges::fill(rng, 1.0F);
+    benchmark::DoNotOptimize(base.data());
+    benchmark::ClobberMemory();
+  }
+
+  set_ring_counters(state, rng.size());
+}
+
+void bm_ring_view_fill_segments(benchmark::State& state) {
+  auto base = make_floats(state.range(0));
+  auto rng = ring_view(base, static_cast<std::size_t>(state.range(1)));
+
+  for ([[maybe_unused]] auto iter : state) {
+    dlgr::ranges::fill(rng, 1.0F);
+    benchmark::DoNotOptimize(base.data());
+    benchmark::ClobberMemory();
+  }
+
+  set_ring_counters(state, rng.size());
+}
+
+void bm_ring_view_for_each_iterator(benchmark::State& state) {
+  const auto base = make_floats(state.range(0));
+  const auto rng = ring_view(base, static_cast<std::size_t>(state.range(1)));
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto sum = 0.0F;
+    std::ranges::for_each(rng, [&sum](float val) { sum += val; });
+    benchmark::DoNotOptimize(sum);
+  }
+
+  set_ring_counters(state, rng.size());
+}
+
+void bm_ring_view_for_each_segments(benchmark::State& state) {
+  const auto base = make_floats(state.range(0));
+  const auto rng = ring_view(base, static_cast<std::size_t>(state.range(1)));
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto sum = 0.0F;
+    dlgr::ranges::for_each(rng, [&sum](float val) { sum += val; });
+    benchmark::DoNotOptimize(sum);
+  }
+
+  set_ring_counters(state, rng.size());
+}
+
+// Cursor which wraps with std::div, as ring_view::iterator did before caching the lap length
+template <class IterType>
+class div_cursor {
+ public:
+  div_cursor(IterType begin, IterType end) : curr_(begin), begin_(begin), end_(end) {}
+
+  auto operator+=(std::ptrdiff_t diff) -> div_cursor& {
+    const auto to_end = end_ - curr_;
+    if (diff < to_end) {
+      curr_ += diff;
+    } else {
+      const auto div_mod = std::div(diff - to_end, end_ - begin_);
+      curr_ = begin_ + div_mod.rem;
+    }
+    return *this;
+  }
+
+  auto operator*() const -> decltype(auto) { return *curr_; }
+
+ private:
+  IterType curr_;
+  IterType begin_;
+  IterType end_;
+};
+
+auto make_jumps(std::int64_t base_size) -> std::vector<std::ptrdiff_t> {
+  constexpr auto jumps_count = 4'096;
+  auto engine = std::mt19937_64(42);  // NOLINT(cert-msc32-c,cert-msc51-cpp): Reproducible
+  auto dist = std::uniform_int_distribution<std::ptrdiff_t>(0, base_size * 16);
+  auto jumps = std::vector<std::ptrdiff_t>(jumps_count);
+  std::ranges::generate(jumps, [&] { return dist(engine); });
+  return jumps;
+}
+
+void bm_ring_view_random_jump_div(benchmark::State& state) {
+  const auto base = make_floats(state.range(0));
+  const auto jumps = make_jumps(state.range(0));
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto cursor = div_cursor(base.begin(), base.end());
+    for (auto jump : jumps) {
+      cursor += jump;
+      benchmark::DoNotOptimize(*cursor);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(jumps.size()));
+}
+
+void bm_ring_view_random_jump(benchmark::State& state) {
+  const auto base = make_floats(state.range(0));
+  const auto jumps = make_jumps(state.range(0));
+  const auto rng = ring_view(base);
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto cursor = rng.begin();
+    for (auto jump : jumps) {
+      cursor += jump;
+      benchmark::DoNotOptimize(*cursor);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(jumps.size()));
+}
+
+void bm_ring_view_subscript(benchmark::State& state) {
+  const auto base = make_floats(state.range(0));
+  const auto jumps = make_jumps(state.range(0));
+  const auto rng = ring_view(base);
+
+  for ([[maybe_unused]] auto iter : state) {
+    const auto cursor = rng.begin();
+    for (auto jump : jumps) {
+      benchmark::DoNotOptimize(cursor[jump]);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(jumps.size()));
+}
+
+// Strided walk of 4096 steps, one increment of the ring iterator per skipped element
+void bm_ring_view_stride_increment(benchmark::State& state) {
+  constexpr auto steps = 4'096;
+  const auto base = make_floats(state.range(0));
+  const auto stride = state.range(1);
+  const auto rng = ring_view(base);
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto cursor = rng.begin();
+    for (auto step = 0; step < steps; ++step) {
+      benchmark::DoNotOptimize(*cursor);
+      for (auto skip = std::int64_t{0}; skip < stride; ++skip) {
+        ++cursor;
+      }
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * steps);
+}
+
+void bm_ring_view_stride_jump(benchmark::State& state) {
+  constexpr auto steps = 4'096;
+  const auto base = make_floats(state.range(0));
+  const auto stride = state.range(1);
+  const auto rng = ring_view(base);
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto cursor = rng.begin();
+    for (auto step = 0; step < steps; ++step) {
+      benchmark::DoNotOptimize(*cursor);
+      cursor += stride;
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * steps);
+}
+
+void bm_ring_view_stride_view(benchmark::State& state) {
+  constexpr auto steps = 4'096;
+  const auto base = make_floats(state.range(0));
+  const auto rng = base | dlgr::views::ring_stride(state.range(1));
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto cursor = rng.begin();
+    for (auto step = 0; step < steps; ++step) {
+      benchmark::DoNotOptimize(*cursor);
+      ++cursor;
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * steps);
+}
+
+// TODO(compiler): Drop the check when every supported standard library has views::stride
+#if defined(__cpp_lib_ranges_stride)
+void bm_ring_view_stride_std(benchmark::State& state) {
+  constexpr auto steps = 4'096;
+  const auto base = make_floats(state.range(0));
+  const auto rng = ring_view(base) | std::views::stride(state.range(1));
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto cursor = rng.begin();
+    for (auto step = 0; step < steps; ++step) {
+      benchmark::DoNotOptimize(*cursor);
+      ++cursor;
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * steps);
+}
+#endif
+
+// Bound laps of a constexpr schedule, walked through ring_view at run time and through the table
+// static_ring lays out at compile time
+constexpr auto static_schedule = std::array{0.5F, 1.0F, 0.25F, 2.0F, 1.5F, 0.75F, 3.0F};
+constexpr auto static_bound = std::size_t{64};
+
+void bm_ring_view_static_runtime(benchmark::State& state) {
+  const auto rng = ring_view(static_schedule, static_bound);
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto sum = 0.0F;
+    for (auto val : rng) {
+      sum += val;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  set_ring_counters(state, static_schedule.size() * static_bound);
+}
+
+void bm_ring_view_static_table(benchmark::State& state) {
+  for ([[maybe_unused]] auto iter : state) {
+    auto sum = 0.0F;
+    for (auto val : dlgr::views::static_ring<static_schedule, static_bound>) {
+      sum += val;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  set_ring_counters(state, static_schedule.size() * static_bound);
+}
+
+// Two cyclic tables of state.range(0) and state.range(1) entries walked side by side, with a pair
+// of ring_view iterators and with ring_zip
+void bm_ring_view_zip_pair(benchmark::State& state) {
+  constexpr auto steps = 4'096;
+  const auto lhs = make_floats(state.range(0));
+  const auto rhs = make_floats(state.range(1));
+  const auto lhs_rng = ring_view(lhs);
+  const auto rhs_rng = ring_view(rhs);
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto lhs_cursor = lhs_rng.begin();
+    auto rhs_cursor = rhs_rng.begin();
+    auto sum = 0.0F;
+    for (auto step = 0; step < steps; ++step) {
+      sum += *lhs_cursor++ * *rhs_cursor++;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * steps);
+}
+
+void bm_ring_view_zip_view(benchmark::State& state) {
+  constexpr auto steps = 4'096;
+  const auto lhs = make_floats(state.range(0));
+  const auto rhs = make_floats(state.range(1));
+  const auto rng = dlgr::views::ring_zip(lhs, rhs);
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto cursor = rng.begin();
+    auto sum = 0.0F;
+    for (auto step = 0; step < steps; ++step) {
+      const auto [lhs_val, rhs_val] = *cursor++;
+      sum += lhs_val * rhs_val;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * steps);
+}
+
+// Random steps of the combined schedule, one jump of each ring_view iterator against one seek of
+// the ring_zip iterator
+auto make_zip_steps(benchmark::State& state) -> std::vector<std::ptrdiff_t> {
+  constexpr auto steps_count = 4'096;
+  const auto period = std::lcm(state.range(0), state.range(1));
+  auto engine = std::mt19937_64(42);  // NOLINT(cert-msc32-c,cert-msc51-cpp): Reproducible
+  auto dist = std::uniform_int_distribution<std::ptrdiff_t>(0, 16 * period);
+  auto steps = std::vector<std::ptrdiff_t>(steps_count);
+  std::ranges::generate(steps, [&] { return dist(engine); });
+  return steps;
+}
+
+void bm_ring_view_zip_pair_seek(benchmark::State& state) {
+  const auto lhs = make_floats(state.range(0));
+  const auto rhs = make_floats(state.range(1));
+  const auto lhs_rng = ring_view(lhs);
+  const auto rhs_rng = ring_view(rhs);
+  const auto steps = make_zip_steps(state);
+
+  for ([[maybe_unused]] auto iter : state) {
+    for (auto step : steps) {
+      benchmark::DoNotOptimize(lhs_rng.begin()[step]);
+      benchmark::DoNotOptimize(rhs_rng.begin()[step]);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(steps.size()));
+}
+
+void bm_ring_view_zip_seek(benchmark::State& state) {
+  const auto lhs = make_floats(state.range(0));
+  const auto rhs = make_floats(state.range(1));
+  const auto rng = dlgr::views::ring_zip(lhs, rhs);
+  const auto steps = make_zip_steps(state);
+
+  for ([[maybe_unused]] auto iter : state) {
+    const auto cursor = rng.begin();
+    for (auto step : steps) {
+      benchmark::DoNotOptimize(cursor[step]);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(steps.size()));
+}
+
+// Rolling minimum which walks every window again
+void bm_ring_view_window_min_rewalk(benchmark::State& state) {
+  const auto base = make_floats(1'024);
+  const auto rng = ring_view(base, 4);
+  const auto width = state.range(0);
+
+  for ([[maybe_unused]] auto iter : state) {
+    for (auto window : rng | dlgr::views::ring_window(width)) {
+      benchmark::DoNotOptimize(std::ranges::min(window));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(rng.size()));
+}
+
+void bm_ring_view_window_min_incremental(benchmark::State& state) {
+  const auto base = make_floats(1'024);
+  const auto rng = ring_view(base, 4);
+  const auto width = static_cast<std::size_t>(state.range(0));
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto min = dlgr::window_min<float>(width);
+    for (auto val : rng) {
+      min.push(val);
+      if (min.full()) {
+        benchmark::DoNotOptimize(min.value());
+      }
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(rng.size()));
+}
+
+// Sum over state.range(0) laps of a small base
+void bm_ring_view_reduce_segments(benchmark::State& state) {
+  const auto base = make_floats(1'024);
+  const auto rng = ring_view(base, static_cast<std::size_t>(state.range(0)));
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto sum = 0.0F;
+    dlgr::ranges::for_each(rng, [&sum](float val) { sum += val; });
+    benchmark::DoNotOptimize(sum);
+  }
+
+  set_ring_counters(state, rng.size());
+}
+
+void bm_ring_view_reduce_laps(benchmark::State& state) {
+  const auto base = make_floats(1'024);
+  const auto rng = ring_view(base, static_cast<std::size_t>(state.range(0)));
+
+  for ([[maybe_unused]] auto iter : state) {
+    benchmark::DoNotOptimize(dlgr::ranges::ring_reduce(rng, 0.0F));
+  }
+
+  set_ring_counters(state, rng.size());
+}
+
+// Ring of state.range(0) elements over two laps with one seam in the middle, so the laps can not
+// be folded, through ring_view::iterator and with the kernels for simd_isa state.range(1)
+auto make_seam_ring(const std::vector<float>& base) {
+  return ring_view(base, 2) | std::views::drop(base.size() / 2) | std::views::take(base.size());
+}
+
+auto simd_isa_arg(benchmark::State& state) -> dlgr::simd_isa {
+  const auto isa = static_cast<dlgr::simd_isa>(state.range(1));
+  if (isa > dlgr::detected_simd_isa()) {
+    state.SkipWithError("Unsupported instruction set");
+  }
+  return isa;
+}
+
+void bm_ring_view_sum_iterator(benchmark::State& state) {
+  const auto base = make_floats(state.range(0));
+  auto rng = make_seam_ring(base);
+
+  for ([[maybe_unused]] auto iter : state) {
+    benchmark::DoNotOptimize(std::accumulate(rng.begin(), rng.end(), 0.0F));
+  }
+
+  set_ring_counters(state, base.size());
+}
+
+void bm_ring_view_sum_simd(benchmark::State& state) {
+  const auto base = make_floats(state.range(0));
+  auto rng = make_seam_ring(base);
+  const auto isa = simd_isa_arg(state);
+
+  for ([[maybe_unused]] auto iter : state) {
+    benchmark::DoNotOptimize(dlgr::ranges::simd_reduce(rng, isa));
+  }
+
+  set_ring_counters(state, base.size());
+}
+
+void bm_ring_view_dot_iterator(benchmark::State& state) {
+  const auto base = make_floats(state.range(0));
+  const auto coefs = make_floats(state.range(0));
+  auto rng = make_seam_ring(base);
+
+  for ([[maybe_unused]] auto iter : state) {
+    benchmark::DoNotOptimize(std::inner_product(rng.begin(), rng.end(), coefs.begin(), 0.0F));
+  }
+
+  set_ring_counters(state, base.size());
+}
+
+void bm_ring_view_dot_simd(benchmark::State& state) {
+  const auto base = make_floats(state.range(0));
+  const auto coefs = make_floats(state.range(0));
+  auto rng = make_seam_ring(base);
+  const auto isa = simd_isa_arg(state);
+
+  for ([[maybe_unused]] auto iter : state) {
+    benchmark::DoNotOptimize(dlgr::ranges::simd_dot(rng, coefs, isa));
+  }
+
+  set_ring_counters(state, base.size());
+}
+
+void bm_ring_view_min_iterator(benchmark::State& state) {
+  const auto base = make_floats(state.range(0));
+  auto rng = make_seam_ring(base);
+
+  for ([[maybe_unused]] auto iter : state) {
+    benchmark::DoNotOptimize(std::ranges::min(rng));
+  }
+
+  set_ring_counters(state, base.size());
+}
+
+void bm_ring_view_min_simd(benchmark::State& state) {
+  const auto base = make_floats(state.range(0));
+  auto rng = make_seam_ring(base);
+  const auto isa = simd_isa_arg(state);
+
+  for ([[maybe_unused]] auto iter : state) {
+    benchmark::DoNotOptimize(dlgr::ranges::simd_min(rng, isa));
+  }
+
+  set_ring_counters(state, base.size());
+}
+
+void bm_ring_view_scale_iterator(benchmark::State& state) {
+  const auto base = make_floats(state.range(0));
+  auto rng = make_seam_ring(base);
+  auto out = std::vector<float>(base.size());
+
+  for ([[maybe_unused]] auto iter : state) {
+    std::transform(rng.begin(), rng.end(), out.begin(), [](float val) { return val * 0.5F; });
+    benchmark::DoNotOptimize(out.data());
+  }
+
+  set_ring_counters(state, base.size());
+}
+
+void bm_ring_view_scale_simd(benchmark::State& state) {
+  const auto base = make_floats(state.range(0));
+  auto rng = make_seam_ring(base);
+  auto out = std::vector<float>(base.size());
+  const auto isa = simd_isa_arg(state);
+
+  for ([[maybe_unused]] auto iter : state) {
+    dlgr::ranges::simd_transform(rng, out.begin(), [](auto val) { return val * 0.5F; }, isa);
+    benchmark::DoNotOptimize(out.data());
+  }
+
+  set_ring_counters(state, base.size());
+}
+
+// Whole ring split between state.range(0) threads
+void bm_ring_view_parallel_reduce(benchmark::State& state) {
+  const auto base = make_floats(1 << 16);
+  const auto rng = ring_view(base, 64);
+  const auto options = dlgr::ranges::parallel_options{
+      .threads = static_cast<std::size_t>(state.range(0)), .min_chunk_size = 1};
+
+  for ([[maybe_unused]] auto iter : state) {
+    benchmark::DoNotOptimize(dlgr::ranges::parallel_reduce(rng, 0.0F, std::plus<>(), options));
+  }
+
+  set_ring_counters(state, rng.size());
+}
+
+void bm_ring_view_parallel_transform(benchmark::State& state) {
+  const auto base = make_floats(1 << 16);
+  const auto rng = ring_view(base, 64);
+  const auto options = dlgr::ranges::parallel_options{
+      .threads = static_cast<std::size_t>(state.range(0)), .min_chunk_size = 1};
+  auto out = std::vector<float>(rng.size());
+
+  for ([[maybe_unused]] auto iter : state) {
+    dlgr::ranges::parallel_transform(
+        rng, out.begin(), [](float val) { return val * 2.0F; }, options);
+    benchmark::DoNotOptimize(out.data());
+  }
+
+  set_ring_counters(state, rng.size());
+}
+
+// Base size, bound
+void ring_args(benchmark::internal::Benchmark* bench) {
+  bench->Args({64, 256})->Args({1'024, 16})->Args({16'384, 4});
+}
+
+// Ring size, simd_isa
+void simd_args(benchmark::internal::Benchmark* bench) {
+  bench->ArgsProduct({{1'024, 65'536}, {0, 1, 2}});
+}
+
+// Base size: power of two and not
+void jump_args(benchmark::internal::Benchmark* bench) {
+  bench->Arg(1'000)->Arg(1'024)->Arg(100'003)->Arg(131'072);
+}
+
+// Base size, stride
+void stride_args(benchmark::internal::Benchmark* bench) {
+  bench->ArgsProduct({{1'000, 1'024}, {3, 97}});
+}
+
+// First table size, second table size
+void zip_args(benchmark::internal::Benchmark* bench) {
+  bench->Args({7, 24})->Args({1'000, 1'024});
+}
+
+}  // namespace
+
+// NOLINTBEGIN
+BENCHMARK(bm_ring_view_copy_iterator)->Apply(ring_args);
+BENCHMARK(bm_ring_view_copy_segments)->Apply(ring_args);
+BENCHMARK(bm_ring_view_transform_iterator)->Apply(ring_args);
+BENCHMARK(bm_ring_view_transform_segments)->Apply(ring_args);
+BENCHMARK(bm_ring_view_fill_iterator)->Apply(ring_args);
+BENCHMARK(bm_ring_view_fill_segments)->Apply(ring_args);
+BENCHMARK(bm_ring_view_for_each_iterator)->Apply(ring_args);
+BENCHMARK(bm_ring_view_for_each_segments)->Apply(ring_args);
+BENCHMARK(bm_ring_view_random_jump_div)->Apply(jump_args);
+BENCHMARK(bm_ring_view_random_jump)->Apply(jump_args);
+BENCHMARK(bm_ring_view_subscript)->Apply(jump_args);
+BENCHMARK(bm_ring_view_stride_increment)->Apply(stride_args);
+BENCHMARK(bm_ring_view_stride_jump)->Apply(stride_args);
+BENCHMARK(bm_ring_view_stride_view)->Apply(stride_args);
+#if defined(__cpp_lib_ranges_stride)
+BENCHMARK(bm_ring_view_stride_std)->Apply(stride_args);
+#endif
+BENCHMARK(bm_ring_view_static_runtime);
+BENCHMARK(bm_ring_view_static_table);
+BENCHMARK(bm_ring_view_zip_pair)->Apply(zip_args);
+BENCHMARK(bm_ring_view_zip_view)->Apply(zip_args);
+BENCHMARK(bm_ring_view_zip_pair_seek)->Apply(zip_args);
+BENCHMARK(bm_ring_view_zip_seek)->Apply(zip_args);
+BENCHMARK(bm_ring_view_window_min_rewalk)->Arg(4)->Arg(64)->Arg(512);
+BENCHMARK(bm_ring_view_window_min_incremental)->Arg(4)->Arg(64)->Arg(512);
+BENCHMARK(bm_ring_view_reduce_segments)->Arg(4)->Arg(64)->Arg(4'096);
+BENCHMARK(bm_ring_view_reduce_laps)->Arg(4)->Arg(64)->Arg(4'096);
+BENCHMARK(bm_ring_view_sum_iterator)->Arg(1'024)->Arg(65'536);
+BENCHMARK(bm_ring_view_sum_simd)->Apply(simd_args);
+BENCHMARK(bm_ring_view_dot_iterator)->Arg(1'024)->Arg(65'536);
+BENCHMARK(bm_ring_view_dot_simd)->Apply(simd_args);
+BENCHMARK(bm_ring_view_min_iterator)->Arg(1'024)->Arg(65'536);
+BENCHMARK(bm_ring_view_min_simd)->Apply(simd_args);
+BENCHMARK(bm_ring_view_scale_iterator)->Arg(1'024)->Arg(65'536);
+BENCHMARK(bm_ring_view_scale_simd)->Apply(simd_args);
+BENCHMARK(bm_ring_view_parallel_reduce)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK(bm_ring_view_parallel_transform)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+// NOLINTEND
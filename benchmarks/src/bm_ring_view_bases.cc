@@ -0,0 +1,386 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <span>
+#include <vector>
+#include <version>
+
+#include <dlgr/ring_view.h>
+
+// ring_view over every base category of the ring_view tests, each against a hand-written loop
+// with the same access pattern and, where the standard library has it, std::views::repeat | join
+
+namespace {
+
+using dlgr::ranges::ring_view;
+
+using vector_base = std::vector<float>;
+using deque_base = std::deque<float>;
+using list_base = std::list<float>;
+using forward_list_base = std::forward_list<float>;
+using span_base = std::span<const float>;
+
+// Base size, bound
+void bases_args(benchmark::internal::Benchmark* bench) {
+  bench->Args({16, 64})->Args({1'024, 16});
+}
+
+auto make_storage(std::int64_t size) -> std::vector<float> {
+  auto out = std::vector<float>(static_cast<std::size_t>(size));
+  std::iota(out.begin(), out.end(), 0.0F);
+  return out;
+}
+
+// Storage must outlive span bases
+template <class BaseType>
+auto make_base(const std::vector<float>& storage) -> BaseType {
+  return BaseType(storage.begin(), storage.end());
+}
+
+auto ring_size(benchmark::State& state) -> std::size_t {
+  return static_cast<std::size_t>(state.range(0) * state.range(1));
+}
+
+void set_items(benchmark::State& state, std::size_t items) {
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(items));
+}
+
+// Offsets into a bounded ring of state.range(0) * state.range(1) elements
+auto make_offsets(benchmark::State& state) -> std::vector<std::ptrdiff_t> {
+  constexpr auto offsets_count = 4'096;
+  auto engine = std::mt19937_64(42);  // NOLINT(cert-msc32-c,cert-msc51-cpp): Reproducible
+  auto dist = std::uniform_int_distribution<std::ptrdiff_t>(
+      0, static_cast<std::ptrdiff_t>(ring_size(state)) - 1);
+  auto offsets = std::vector<std::ptrdiff_t>(offsets_count);
+  std::ranges::generate(offsets, [&] { return dist(engine); });
+  return offsets;
+}
+
+// == Sequential iteration
+
+template <class BaseType>
+void bm_ring_view_iterate(benchmark::State& state) {
+  const auto storage = make_storage(state.range(0));
+  const auto base = make_base<BaseType>(storage);
+  const auto rng = ring_view(base, static_cast<std::size_t>(state.range(1)));
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto sum = 0.0F;
+    for (auto val : rng) {
+      sum += val;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  set_items(state, ring_size(state));
+}
+
+// Index modulo size where the base has random access, a wrapping iterator otherwise
+template <class BaseType>
+void bm_ring_view_iterate_manual(benchmark::State& state) {
+  const auto storage = make_storage(state.range(0));
+  const auto base = make_base<BaseType>(storage);
+  const auto count = ring_size(state);
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto sum = 0.0F;
+    if constexpr (std::ranges::random_access_range<const BaseType>) {
+      const auto size = std::ranges::size(base);
+      for (auto idx = std::size_t{0}; idx < count; ++idx) {
+        sum += base[idx % size];
+      }
+    } else {
+      auto curr = base.begin();
+      for (auto idx = std::size_t{0}; idx < count; ++idx) {
+        sum += *curr;
+        if (++curr == base.end()) {
+          curr = base.begin();
+        }
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  set_items(state, count);
+}
+
+// TODO(compiler): Drop the check when every supported standard library has views::repeat
+#if defined(__cpp_lib_ranges_repeat)
+template <class BaseType>
+void bm_ring_view_iterate_repeat_join(benchmark::State& state) {
+  const auto storage = make_storage(state.range(0));
+  const auto base = make_base<BaseType>(storage);
+  const auto rng = std::views::repeat(std::views::all(base), state.range(1)) | std::views::join;
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto sum = 0.0F;
+    for (auto val : rng) {
+      sum += val;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  set_items(state, ring_size(state));
+}
+#endif
+
+// == Random jumps
+
+template <class BaseType>
+void bm_ring_view_jump(benchmark::State& state) {
+  const auto storage = make_storage(state.range(0));
+  const auto base = make_base<BaseType>(storage);
+  const auto offsets = make_offsets(state);
+  const auto rng = ring_view(base);
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto cursor = rng.begin();
+    for (auto offset : offsets) {
+      cursor += offset;
+      benchmark::DoNotOptimize(*cursor);
+    }
+  }
+
+  set_items(state, offsets.size());
+}
+
+template <class BaseType>
+void bm_ring_view_jump_manual(benchmark::State& state) {
+  const auto storage = make_storage(state.range(0));
+  const auto base = make_base<BaseType>(storage);
+  const auto offsets = make_offsets(state);
+  const auto size = static_cast<std::ptrdiff_t>(std::ranges::size(base));
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto idx = std::ptrdiff_t{0};
+    for (auto offset : offsets) {
+      idx = (idx + offset) % size;
+      benchmark::DoNotOptimize(base[static_cast<std::size_t>(idx)]);
+    }
+  }
+
+  set_items(state, offsets.size());
+}
+
+// == Distance
+
+template <class BaseType>
+void bm_ring_view_distance(benchmark::State& state) {
+  const auto storage = make_storage(state.range(0));
+  const auto base = make_base<BaseType>(storage);
+  const auto rng = ring_view(base, static_cast<std::size_t>(state.range(1)));
+
+  auto iters = std::vector<std::ranges::iterator_t<decltype(rng)>>();
+  for (auto offset : make_offsets(state)) {
+    iters.push_back(rng.begin() + offset);
+  }
+
+  for ([[maybe_unused]] auto iter : state) {
+    for (auto idx = std::size_t{1}; idx < iters.size(); ++idx) {
+      benchmark::DoNotOptimize(iters[idx] - iters[idx - 1]);
+    }
+  }
+
+  set_items(state, iters.size() - 1);
+}
+
+// Lap and index pairs
+template <class BaseType>
+void bm_ring_view_distance_manual(benchmark::State& state) {
+  struct position {
+    std::ptrdiff_t lap = 0;
+    std::ptrdiff_t index = 0;
+  };
+
+  const auto size = static_cast<std::ptrdiff_t>(state.range(0));
+  auto positions = std::vector<position>();
+  for (auto offset : make_offsets(state)) {
+    positions.push_back({.lap = offset / size, .index = offset % size});
+  }
+
+  for ([[maybe_unused]] auto iter : state) {
+    for (auto idx = std::size_t{1}; idx < positions.size(); ++idx) {
+      const auto& lhs = positions[idx];
+      const auto& rhs = positions[idx - 1];
+      benchmark::DoNotOptimize((lhs.lap - rhs.lap) * size + (lhs.index - rhs.index));
+    }
+  }
+
+  set_items(state, positions.size() - 1);
+}
+
+// == end() construction
+
+// Constant cost of making the bounded end() iterator: random access bases reuse the lap length
+// cached by the view, other bases carry no length, so none of these walk the base. Only bases
+// which end in a sentinel do, see the sentinel benchmarks below.
+template <class BaseType>
+void bm_ring_view_end(benchmark::State& state) {
+  const auto storage = make_storage(state.range(0));
+  const auto base = make_base<BaseType>(storage);
+  const auto rng = ring_view(base, static_cast<std::size_t>(state.range(1)));
+
+  for ([[maybe_unused]] auto iter : state) {
+    benchmark::DoNotOptimize(rng.end());
+  }
+
+  set_items(state, 1);
+}
+
+// == Compact iterators
+
+// Static-extent contiguous bases get a 16-byte iterator, dynamic spans the generic one
+constexpr auto fixed_size = std::size_t{1'024};
+using fixed_span_base = std::span<const float, fixed_size>;
+
+template <class BaseType>
+auto make_span_base(const std::vector<float>& storage) -> BaseType {
+  return BaseType(storage.data(), fixed_size);
+}
+
+// Bound
+void compact_args(benchmark::internal::Benchmark* bench) { bench->Arg(16); }
+
+template <class BaseType>
+void bm_ring_view_compact_iterate(benchmark::State& state) {
+  const auto storage = make_storage(fixed_size);
+  const auto rng = ring_view(make_span_base<BaseType>(storage),
+                             static_cast<std::size_t>(state.range(0)));
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto sum = 0.0F;
+    for (auto val : rng) {
+      sum += val;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  set_items(state, fixed_size * static_cast<std::size_t>(state.range(0)));
+}
+
+// Many live cursors stepped in turn, where the iterator size decides the cache footprint
+template <class BaseType>
+void bm_ring_view_compact_cursors(benchmark::State& state) {
+  constexpr auto cursors_count = std::size_t{4'096};
+  constexpr auto steps = std::size_t{8};
+
+  const auto storage = make_storage(fixed_size);
+  const auto rng = ring_view(make_span_base<BaseType>(storage),
+                             static_cast<std::size_t>(state.range(0)));
+
+  auto initial = std::vector<std::ranges::iterator_t<decltype(rng)>>();
+  for (auto idx = std::size_t{0}; idx < cursors_count; ++idx) {
+    initial.push_back(rng.begin() + static_cast<std::ptrdiff_t>(idx * 7 % fixed_size));
+  }
+  auto cursors = initial;
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto sum = 0.0F;
+    for (auto step = std::size_t{0}; step < steps; ++step) {
+      for (auto& cursor : cursors) {
+        sum += *cursor++;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+    std::ranges::copy(initial, cursors.begin());
+  }
+
+  set_items(state, cursors_count * steps);
+}
+
+// == Sentinel-terminated bases
+
+// Generated base whose end is only known by a predicate, as with a schedule computed on the fly
+auto make_generated_base(std::int64_t size) {
+  return std::views::iota(std::int64_t{0})
+         | std::views::take_while([size](std::int64_t val) { return val < size; })
+         | std::views::transform([](std::int64_t val) { return static_cast<float>(val); });
+}
+
+void bm_ring_view_sentinel_iterate(benchmark::State& state) {
+  const auto base = make_generated_base(state.range(0));
+  const auto rng = ring_view(base, static_cast<std::size_t>(state.range(1)));
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto sum = 0.0F;
+    for (auto val : rng) {
+      sum += val;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  set_items(state, ring_size(state));
+}
+
+// What sentinel bases needed before: a copy into a vector first
+void bm_ring_view_sentinel_materialize(benchmark::State& state) {
+  const auto base = make_generated_base(state.range(0));
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto storage = std::vector<float>();
+    std::ranges::copy(base, std::back_inserter(storage));
+    const auto rng = ring_view(storage, static_cast<std::size_t>(state.range(1)));
+
+    auto sum = 0.0F;
+    for (auto val : rng) {
+      sum += val;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  set_items(state, ring_size(state));
+}
+
+}  // namespace
+
+// NOLINTBEGIN
+BENCHMARK_TEMPLATE(bm_ring_view_iterate, vector_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_iterate, deque_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_iterate, list_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_iterate, forward_list_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_iterate, span_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_iterate_manual, vector_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_iterate_manual, deque_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_iterate_manual, list_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_iterate_manual, forward_list_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_iterate_manual, span_base)->Apply(bases_args);
+#if defined(__cpp_lib_ranges_repeat)
+BENCHMARK_TEMPLATE(bm_ring_view_iterate_repeat_join, vector_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_iterate_repeat_join, deque_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_iterate_repeat_join, list_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_iterate_repeat_join, forward_list_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_iterate_repeat_join, span_base)->Apply(bases_args);
+#endif
+BENCHMARK_TEMPLATE(bm_ring_view_jump, vector_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_jump, deque_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_jump, span_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_jump_manual, vector_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_jump_manual, deque_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_jump_manual, span_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_distance, vector_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_distance, deque_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_distance, span_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_distance_manual, vector_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_end, vector_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_end, deque_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_end, list_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_end, forward_list_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_end, span_base)->Apply(bases_args);
+BENCHMARK_TEMPLATE(bm_ring_view_compact_iterate, fixed_span_base)->Apply(compact_args);
+BENCHMARK_TEMPLATE(bm_ring_view_compact_iterate, span_base)->Apply(compact_args);
+BENCHMARK_TEMPLATE(bm_ring_view_compact_cursors, fixed_span_base)->Apply(compact_args);
+BENCHMARK_TEMPLATE(bm_ring_view_compact_cursors, span_base)->Apply(compact_args);
+BENCHMARK(bm_ring_view_sentinel_iterate)->Apply(bases_args);
+BENCHMARK(bm_ring_view_sentinel_materialize)->Apply(bases_args);
+// NOLINTEND
@@ -0,0 +1,172 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <dlgr/ring_view.h>
+
+// Per-element cost of the ring_view iterator contracts: every op below runs once with the checked
+// default and once with the preconditions only assumed
+
+namespace {
+
+using dlgr::ranges::ring_view;
+using dlgr::ranges::ring_view_assume_contracts_t;
+using dlgr::ranges::ring_view_bound_t;
+using dlgr::ranges::ring_view_check_contracts_t;
+
+constexpr auto fixed_size = std::size_t{1'024};
+
+using span_base = std::span<const float>;
+using fixed_span_base = std::span<const float, fixed_size>;
+
+template <class BaseType, class ContractPolicy>
+using ring_type = ring_view<BaseType, ring_view_bound_t, ContractPolicy>;
+
+auto make_storage() -> std::vector<float> {
+  auto out = std::vector<float>(fixed_size);
+  std::iota(out.begin(), out.end(), 0.0F);
+  return out;
+}
+
+template <class BaseType, class ContractPolicy>
+auto make_ring(const std::vector<float>& storage, std::int64_t bound)
+    -> ring_type<BaseType, ContractPolicy> {
+  return ring_type<BaseType, ContractPolicy>(BaseType(storage.data(), fixed_size),
+                                             static_cast<std::size_t>(bound));
+}
+
+void set_items(benchmark::State& state, std::size_t items) {
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(items));
+}
+
+// Random offsets into the bounded ring, half of them backwards
+auto make_jumps(std::int64_t bound) -> std::vector<std::ptrdiff_t> {
+  constexpr auto jumps_count = 4'096;
+  const auto ring_size = static_cast<std::ptrdiff_t>(fixed_size) * bound;
+  auto engine = std::mt19937_64(42);  // NOLINT(cert-msc32-c,cert-msc51-cpp): Reproducible
+  auto dist = std::uniform_int_distribution<std::ptrdiff_t>(0, ring_size - 1);
+  auto jumps = std::vector<std::ptrdiff_t>(jumps_count);
+  std::ranges::generate(jumps, [&] { return dist(engine); });
+  return jumps;
+}
+
+// == Increment and access
+
+template <class BaseType, class ContractPolicy>
+void bm_ring_view_contracts_iterate(benchmark::State& state) {
+  const auto storage = make_storage();
+  const auto rng = make_ring<BaseType, ContractPolicy>(storage, state.range(0));
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto sum = 0.0F;
+    for (auto val : rng) {
+      sum += val;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  set_items(state, rng.size());
+}
+
+// == Decrement and access
+
+template <class BaseType, class ContractPolicy>
+void bm_ring_view_contracts_reverse(benchmark::State& state) {
+  const auto storage = make_storage();
+  const auto rng = make_ring<BaseType, ContractPolicy>(storage, state.range(0));
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto sum = 0.0F;
+    for (auto cursor = rng.end(); cursor != rng.begin();) {
+      sum += *--cursor;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  set_items(state, rng.size());
+}
+
+// == Jumps (add and sub)
+
+template <class BaseType, class ContractPolicy>
+void bm_ring_view_contracts_jump(benchmark::State& state) {
+  const auto storage = make_storage();
+  const auto rng = make_ring<BaseType, ContractPolicy>(storage, state.range(0));
+  const auto jumps = make_jumps(state.range(0));
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto cursor = rng.begin();
+    auto prev = std::ptrdiff_t{0};
+    for (auto jump : jumps) {
+      cursor += jump - prev;
+      prev = jump;
+      benchmark::DoNotOptimize(*cursor);
+    }
+  }
+
+  set_items(state, jumps.size());
+}
+
+// == Distance (operator-)
+
+template <class BaseType, class ContractPolicy>
+void bm_ring_view_contracts_distance(benchmark::State& state) {
+  const auto storage = make_storage();
+  const auto rng = make_ring<BaseType, ContractPolicy>(storage, state.range(0));
+  const auto jumps = make_jumps(state.range(0));
+
+  auto cursors = std::vector<typename ring_type<BaseType, ContractPolicy>::const_iterator_type>();
+  for (auto jump : jumps) {
+    cursors.push_back(rng.begin() + jump);
+  }
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto total = std::ptrdiff_t{0};
+    for (auto idx = std::size_t{1}; idx < cursors.size(); ++idx) {
+      total += cursors[idx] - cursors[idx - 1];
+    }
+    benchmark::DoNotOptimize(total);
+  }
+
+  set_items(state, cursors.size() - 1);
+}
+
+// Bound
+void contracts_args(benchmark::internal::Benchmark* bench) { bench->Arg(16); }
+
+}  // namespace
+
+// NOLINTBEGIN
+BENCHMARK_TEMPLATE(bm_ring_view_contracts_iterate, span_base, ring_view_check_contracts_t)
+    ->Apply(contracts_args);
+BENCHMARK_TEMPLATE(bm_ring_view_contracts_iterate, span_base, ring_view_assume_contracts_t)
+    ->Apply(contracts_args);
+BENCHMARK_TEMPLATE(bm_ring_view_contracts_iterate, fixed_span_base, ring_view_check_contracts_t)
+    ->Apply(contracts_args);
+BENCHMARK_TEMPLATE(bm_ring_view_contracts_iterate, fixed_span_base, ring_view_assume_contracts_t)
+    ->Apply(contracts_args);
+BENCHMARK_TEMPLATE(bm_ring_view_contracts_reverse, span_base, ring_view_check_contracts_t)
+    ->Apply(contracts_args);
+BENCHMARK_TEMPLATE(bm_ring_view_contracts_reverse, span_base, ring_view_assume_contracts_t)
+    ->Apply(contracts_args);
+BENCHMARK_TEMPLATE(bm_ring_view_contracts_reverse, fixed_span_base, ring_view_check_contracts_t)
+    ->Apply(contracts_args);
+BENCHMARK_TEMPLATE(bm_ring_view_contracts_reverse, fixed_span_base, ring_view_assume_contracts_t)
+    ->Apply(contracts_args);
+BENCHMARK_TEMPLATE(bm_ring_view_contracts_jump, span_base, ring_view_check_contracts_t)
+    ->Apply(contracts_args);
+BENCHMARK_TEMPLATE(bm_ring_view_contracts_jump, span_base, ring_view_assume_contracts_t)
+    ->Apply(contracts_args);
+BENCHMARK_TEMPLATE(bm_ring_view_contracts_distance, span_base, ring_view_check_contracts_t)
+    ->Apply(contracts_args);
+BENCHMARK_TEMPLATE(bm_ring_view_contracts_distance, span_base, ring_view_assume_contracts_t)
+    ->Apply(contracts_args);
+// NOLINTEND
@@ -0,0 +1,162 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <dlgr/ring_buffer.h>
+#include <dlgr/rolling_histogram.h>
+
+// Latency percentiles over the last range(0) samples: the baseline keeps them in an overwriting
+// ring_buffer and sorts a copy for every query, rolling_histogram walks its bins instead.
+
+namespace {
+
+using histogram_type = dlgr::rolling_histogram<>;
+using samples_type =
+    dlgr::ring_buffer<std::uint64_t, std::allocator<std::uint64_t>, dlgr::ring_buffer_overwrite_t>;
+
+constexpr auto percentiles = std::array{0.5, 0.99, 0.999};
+constexpr auto histogram_buckets = std::size_t{60};
+
+auto make_latencies(std::size_t count) -> std::vector<std::uint64_t> {
+  auto gen = std::mt19937_64(42);
+  auto dist = std::lognormal_distribution<double>(10.0, 1.5);
+  auto out = std::vector<std::uint64_t>(count);
+  std::ranges::generate(out, [&] { return static_cast<std::uint64_t>(dist(gen)); });
+  return out;
+}
+
+// == Recording
+
+void bm_rolling_histogram_record_ring_buffer(benchmark::State& state) {
+  const auto latencies = make_latencies(1024);
+  auto samples = samples_type(static_cast<std::size_t>(state.range(0)));
+
+  auto idx = std::size_t{0};
+  for ([[maybe_unused]] auto iter : state) {
+    samples.push_back(latencies[idx++ % latencies.size()]);
+  }
+
+  benchmark::DoNotOptimize(samples.size());
+  state.SetItemsProcessed(state.iterations());
+}
+
+void bm_rolling_histogram_record(benchmark::State& state) {
+  const auto latencies = make_latencies(1024);
+  auto histogram = histogram_type(std::chrono::seconds(1), histogram_buckets);
+
+  auto idx = std::size_t{0};
+  for ([[maybe_unused]] auto iter : state) {
+    histogram.record(latencies[idx++ % latencies.size()]);
+  }
+
+  benchmark::DoNotOptimize(histogram.count());
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Every iteration records 2^16 values split between range(0) threads
+void bm_rolling_histogram_record_threads(benchmark::State& state) {
+  constexpr auto records = std::size_t{1} << 16U;
+  const auto n_threads = static_cast<std::size_t>(state.range(0));
+  const auto latencies = make_latencies(1024);
+  auto histogram = histogram_type(std::chrono::seconds(1), histogram_buckets);
+
+  for ([[maybe_unused]] auto iter : state) {
+    auto threads = std::vector<std::thread>();
+    threads.reserve(n_threads);
+    for (auto thread = std::size_t{0}; thread < n_threads; ++thread) {
+      threads.emplace_back([&histogram, &latencies, count = records / n_threads, thread] {
+        for (auto idx = std::size_t{0}; idx < count; ++idx) {
+          histogram.record(latencies[(thread + idx) % latencies.size()]);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(records));
+}
+
+// == Percentiles
+
+void bm_rolling_histogram_percentiles_sort(benchmark::State& state) {
+  const auto window = static_cast<std::size_t>(state.range(0));
+  auto samples = samples_type(window);
+  for (auto latency : make_latencies(window)) {
+    samples.push_back(latency);
+  }
+
+  auto sorted = std::vector<std::uint64_t>();
+  auto out = std::array<std::uint64_t, percentiles.size()>{};
+  for ([[maybe_unused]] auto iter : state) {
+    sorted.assign(samples.begin(), samples.end());
+    std::ranges::sort(sorted);
+    for (auto idx = std::size_t{0}; idx < percentiles.size(); ++idx) {
+      const auto rank = static_cast<double>(sorted.size() - 1) * percentiles[idx];
+      out[idx] = sorted[static_cast<std::size_t>(rank)];
+    }
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+void bm_rolling_histogram_percentiles(benchmark::State& state) {
+  const auto window = static_cast<std::size_t>(state.range(0));
+  auto histogram = histogram_type(std::chrono::seconds(1), histogram_buckets);
+  const auto latencies = make_latencies(window);
+
+  // The samples spread over the whole window, so every bucket is in use
+  for (auto bucket = std::size_t{0}; bucket < histogram_buckets; ++bucket) {
+    for (auto idx = bucket; idx < window; idx += histogram_buckets) {
+      histogram.record(latencies[idx]);
+    }
+    if (bucket + 1 != histogram_buckets) {
+      histogram.rotate();
+    }
+  }
+
+  auto out = std::array<std::uint64_t, percentiles.size()>{};
+  for ([[maybe_unused]] auto iter : state) {
+    histogram.quantiles(percentiles, out);
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+void bm_rolling_histogram_rotate(benchmark::State& state) {
+  auto histogram = histogram_type(std::chrono::seconds(1), histogram_buckets);
+  const auto latencies = make_latencies(1024);
+
+  for ([[maybe_unused]] auto iter : state) {
+    for (auto latency : latencies) {
+      histogram.record(latency);
+    }
+    histogram.rotate();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+// NOLINTBEGIN
+BENCHMARK(bm_rolling_histogram_record_ring_buffer)->Arg(1 << 16);
+BENCHMARK(bm_rolling_histogram_record);
+BENCHMARK(bm_rolling_histogram_record_threads)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+BENCHMARK(bm_rolling_histogram_percentiles_sort)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(bm_rolling_histogram_percentiles)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(bm_rolling_histogram_rotate);
+// NOLINTEND
@@ -0,0 +1,293 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#if defined(__linux__)
+
+#include <benchmark/benchmark.h>
+
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <system_error>
+#include <utility>
+
+#include <dlgr/shm_ring.h>
+
+// The ping-pong of bm_concurrent with the other side in a forked child instead of a thread, so
+// every handoff crosses a process boundary: pipes, process-shared pthread condvars and shm_ring.
+
+namespace {
+
+constexpr auto ipc_stop = std::numeric_limits<std::uint64_t>::max();
+
+// Runs other_side in a forked child and waits for it to exit on destruction
+class forked_child {
+ public:
+  template <class FuncType>
+  explicit forked_child(FuncType other_side) : pid_(::fork()) {
+    if (pid_ < 0) {
+      throw std::system_error(errno, std::system_category(), "fork");
+    }
+    if (pid_ == 0) {
+      other_side();
+      ::_exit(0);
+    }
+  }
+
+  forked_child(const forked_child&) = delete;
+  forked_child(forked_child&&) = delete;
+
+  ~forked_child() noexcept {
+    auto status = 0;
+    ::waitpid(pid_, &status, 0);
+  }
+
+  auto operator=(const forked_child&) -> forked_child& = delete;
+  auto operator=(forked_child&&) -> forked_child& = delete;
+
+ private:
+  ::pid_t pid_ = -1;
+};
+
+// Shared anonymous memory for one object, inherited by forked children
+template <class ValueType>
+class shared_object {
+ public:
+  shared_object() {
+    // NOLINTNEXTLINE(hicpp-signed-bitwise): Flags are ints in the C API
+    auto* mapped = ::mmap(nullptr, sizeof(ValueType), PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (mapped == MAP_FAILED) {
+      throw std::system_error(errno, std::system_category(), "mmap");
+    }
+    object_ = new (mapped) ValueType();
+  }
+
+  shared_object(const shared_object&) = delete;
+  shared_object(shared_object&&) = delete;
+
+  ~shared_object() noexcept {
+    object_->~ValueType();
+    ::munmap(object_, sizeof(ValueType));
+  }
+
+  auto operator=(const shared_object&) -> shared_object& = delete;
+  auto operator=(shared_object&&) -> shared_object& = delete;
+
+  [[nodiscard]] auto operator*() const noexcept -> ValueType& { return *object_; }
+
+ private:
+  ValueType* object_ = nullptr;
+};
+
+// == Ping-pong
+
+void bm_ipc_pipe(benchmark::State& state) {
+  auto ping = std::array<int, 2>{};
+  auto pong = std::array<int, 2>{};
+  if (::pipe(ping.data()) != 0 || ::pipe(pong.data()) != 0) {
+    state.SkipWithError("pipe failed");
+    return;
+  }
+
+  {
+    const auto child = forked_child([&] {
+      auto value = std::uint64_t{0};
+      while (::read(ping[0], &value, sizeof(value)) == ssize_t{sizeof(value)}
+             && value != ipc_stop) {
+        benchmark::DoNotOptimize(::write(pong[1], &value, sizeof(value)));
+      }
+    });
+
+    auto value = std::uint64_t{0};
+    for ([[maybe_unused]] auto iter : state) {
+      benchmark::DoNotOptimize(::write(ping[1], &value, sizeof(value)));
+      benchmark::DoNotOptimize(::read(pong[0], &value, sizeof(value)));
+      ++value;
+    }
+
+    value = ipc_stop;
+    benchmark::DoNotOptimize(::write(ping[1], &value, sizeof(value)));
+  }
+
+  for (auto fd : {ping[0], ping[1], pong[0], pong[1]}) {
+    ::close(fd);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// bm_concurrent_condvar_mutex with process-shared pthread objects
+struct shared_condvar {
+  shared_condvar() {
+    auto mutex_attr = ::pthread_mutexattr_t{};
+    ::pthread_mutexattr_init(&mutex_attr);
+    ::pthread_mutexattr_setpshared(&mutex_attr, PTHREAD_PROCESS_SHARED);
+    ::pthread_mutex_init(&mutex, &mutex_attr);
+    ::pthread_mutexattr_destroy(&mutex_attr);
+
+    auto cond_attr = ::pthread_condattr_t{};
+    ::pthread_condattr_init(&cond_attr);
+    ::pthread_condattr_setpshared(&cond_attr, PTHREAD_PROCESS_SHARED);
+    ::pthread_cond_init(&cond_var, &cond_attr);
+    ::pthread_condattr_destroy(&cond_attr);
+  }
+
+  shared_condvar(const shared_condvar&) = delete;
+  shared_condvar(shared_condvar&&) = delete;
+
+  ~shared_condvar() noexcept {
+    ::pthread_cond_destroy(&cond_var);
+    ::pthread_mutex_destroy(&mutex);
+  }
+
+  auto operator=(const shared_condvar&) -> shared_condvar& = delete;
+  auto operator=(shared_condvar&&) -> shared_condvar& = delete;
+
+  ::pthread_mutex_t mutex = {};
+  ::pthread_cond_t cond_var = {};
+  bool ready = false;
+  bool finish = false;
+};
+
+void bm_ipc_condvar(benchmark::State& state) {
+  const auto shared = shared_object<shared_condvar>();
+  auto& sync = *shared;
+
+  {
+    const auto child = forked_child([&] {
+      ::pthread_mutex_lock(&sync.mutex);
+      while (true) {
+        while (!sync.finish && !sync.ready) {
+          ::pthread_cond_wait(&sync.cond_var, &sync.mutex);
+        }
+        if (sync.finish) {
+          break;
+        }
+        sync.ready = false;
+        ::pthread_cond_signal(&sync.cond_var);
+      }
+      ::pthread_mutex_unlock(&sync.mutex);
+    });
+
+    for ([[maybe_unused]] auto iter : state) {
+      ::pthread_mutex_lock(&sync.mutex);
+      while (sync.ready) {
+        ::pthread_cond_wait(&sync.cond_var, &sync.mutex);
+      }
+      sync.ready = true;
+      ::pthread_mutex_unlock(&sync.mutex);
+      ::pthread_cond_signal(&sync.cond_var);
+    }
+
+    ::pthread_mutex_lock(&sync.mutex);
+    while (sync.ready) {
+      ::pthread_cond_wait(&sync.cond_var, &sync.mutex);
+    }
+    sync.finish = true;
+    ::pthread_mutex_unlock(&sync.mutex);
+    ::pthread_cond_signal(&sync.cond_var);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+void bm_ipc_shm_ring(benchmark::State& state) {
+  auto ping = dlgr::shm_ring<std::uint64_t>(1);
+  auto pong = dlgr::shm_ring<std::uint64_t>(1);
+
+  {
+    const auto child = forked_child([&] {
+      for (auto value = ping.pop(); value != ipc_stop; value = ping.pop()) {
+        pong.push(value);
+      }
+    });
+
+    auto value = std::uint64_t{0};
+    for ([[maybe_unused]] auto iter : state) {
+      ping.push(value);
+      value = pong.pop() + 1;
+    }
+
+    ping.push(ipc_stop);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+// == Streaming
+
+constexpr auto ipc_stream_capacity = std::size_t{1024};
+
+void bm_ipc_pipe_stream(benchmark::State& state) {
+  auto fds = std::array<int, 2>{};
+  if (::pipe(fds.data()) != 0) {
+    state.SkipWithError("pipe failed");
+    return;
+  }
+
+  {
+    const auto child = forked_child([&] {
+      auto sum = std::uint64_t{0};
+      auto value = std::uint64_t{0};
+      while (::read(fds[0], &value, sizeof(value)) == ssize_t{sizeof(value)} && value != ipc_stop) {
+        sum += value;
+      }
+      benchmark::DoNotOptimize(sum);
+    });
+
+    auto value = std::uint64_t{0};
+    for ([[maybe_unused]] auto iter : state) {
+      benchmark::DoNotOptimize(::write(fds[1], &value, sizeof(value)));
+      ++value;
+    }
+
+    value = ipc_stop;
+    benchmark::DoNotOptimize(::write(fds[1], &value, sizeof(value)));
+  }
+
+  ::close(fds[0]);
+  ::close(fds[1]);
+  state.SetItemsProcessed(state.iterations());
+}
+
+void bm_ipc_shm_ring_stream(benchmark::State& state) {
+  auto ring = dlgr::shm_ring<std::uint64_t>(ipc_stream_capacity);
+
+  {
+    const auto child = forked_child([&] {
+      auto sum = std::uint64_t{0};
+      for (auto value = ring.pop(); value != ipc_stop; value = ring.pop()) {
+        sum += value;
+      }
+      benchmark::DoNotOptimize(sum);
+    });
+
+    auto value = std::uint64_t{0};
+    for ([[maybe_unused]] auto iter : state) {
+      ring.push(value++);
+    }
+
+    ring.push(ipc_stop);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+// NOLINTBEGIN
+BENCHMARK(bm_ipc_pipe)->UseRealTime();
+BENCHMARK(bm_ipc_condvar)->UseRealTime();
+BENCHMARK(bm_ipc_shm_ring)->UseRealTime();
+BENCHMARK(bm_ipc_pipe_stream)->UseRealTime();
+BENCHMARK(bm_ipc_shm_ring_stream)->UseRealTime();
+// NOLINTEND
+
+#endif  // defined(__linux__)
@@ -0,0 +1,486 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#pragma once
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "dlgr/async_log_sink.h requires POSIX (writev)"
+#endif
+
+#include <sys/uio.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <dlgr/cache_line.h>
+#include <dlgr/ring_buffer.h>
+#include <dlgr/ring_view.h>
+
+namespace dlgr {
+
+// == Overflow policies
+
+// A record which does not fit is dropped
+struct async_log_drop_t {
+  // NOLINTNEXTLINE(runtime/explicit): Explicit default ctor for tag type
+  constexpr explicit async_log_drop_t() noexcept = default;
+};
+
+inline constexpr async_log_drop_t async_log_drop{};
+
+// The producer waits until the background thread has made room
+struct async_log_block_t {
+  // NOLINTNEXTLINE(runtime/explicit): Explicit default ctor for tag type
+  constexpr explicit async_log_block_t() noexcept = default;
+};
+
+inline constexpr async_log_block_t async_log_block{};
+
+// The oldest records which are not being written yet are dropped to make room, the producer only
+// waits if all of them are
+struct async_log_overwrite_t {
+  // NOLINTNEXTLINE(runtime/explicit): Explicit default ctor for tag type
+  constexpr explicit async_log_overwrite_t() noexcept = default;
+};
+
+inline constexpr async_log_overwrite_t async_log_overwrite{};
+
+template <class T>
+concept async_log_overflow_policy =
+    is_any_of<T, async_log_drop_t, async_log_block_t, async_log_overwrite_t>;
+
+// == Implementation details
+
+namespace detail {
+
+// Moves the index forward to value unless it is there already
+inline auto store_max(std::atomic<std::size_t>& index, std::size_t value,
+                      std::memory_order order) noexcept -> void {
+  auto current = index.load(std::memory_order::relaxed);
+  while (current < value
+         && !index.compare_exchange_weak(current, value, order, std::memory_order::relaxed)) {
+  }
+}
+
+}  // namespace detail
+
+// == async_log_sink implementation
+
+// Log sink which takes write() calls off the hot threads. Every producer appends whole records
+// into a byte ring of its own, and a background thread drains all rings into the descriptor with
+// one writev() call per batch, two segments per ring.
+//
+// Each ring has three free-running indices: the producer publishes records by moving tail, the
+// background thread claims the bytes up to tail by moving start, and frees them by moving head
+// once they are written. Dropping old records to make room moves start from the producer side
+// instead, so both sides compare and swap it. The descriptor is borrowed, not closed, and should
+// be blocking.
+template <async_log_overflow_policy OverflowPolicy = async_log_drop_t>
+class async_log_sink {
+  constexpr static bool is_block_ = std::is_same_v<OverflowPolicy, async_log_block_t>;
+  constexpr static bool is_overwrite_ = std::is_same_v<OverflowPolicy, async_log_overwrite_t>;
+
+  struct producer_ring;
+
+ public:
+  // -- Member types
+
+  using overflow_policy = OverflowPolicy;
+  using size_type = std::size_t;
+  using duration_type = std::chrono::microseconds;
+
+  // Handle for appending from one thread at a time, must not outlive the sink
+  class producer {
+   public:
+    [[nodiscard]] producer() noexcept = default;
+
+    // Copies the record into the ring, returns false if it was dropped. Records larger than the
+    // ring are always dropped.
+    auto append(std::span<const std::byte> record) -> bool {
+      return sink_->append(*ring_, record);
+    }
+
+    auto append(std::string_view record) -> bool {
+      return append(std::as_bytes(std::span(record.data(), record.size())));
+    }
+
+   private:
+    friend class async_log_sink;
+
+    [[nodiscard]] producer(async_log_sink& sink, producer_ring& ring) noexcept
+        : sink_(&sink), ring_(&ring) {}
+
+    async_log_sink* sink_ = nullptr;
+    producer_ring* ring_ = nullptr;
+  };
+
+  // -- Constructors
+
+  // Ring capacity is rounded up to a power of two
+  [[nodiscard]] async_log_sink(int fd, size_type min_ring_capacity,
+                               duration_type flush_interval = std::chrono::milliseconds(1))
+      : fd_(fd),
+        ring_capacity_(std::bit_ceil(std::max(min_ring_capacity, size_type{1}))),
+        flush_interval_(flush_interval) {
+    drainer_ = std::thread([this] { run(); });
+  }
+
+  async_log_sink(const async_log_sink&) = delete;
+  async_log_sink(async_log_sink&&) = delete;
+
+  // -- Destructor
+
+  // Writes out everything appended so far
+  ~async_log_sink() noexcept {
+    {
+      auto lock = std::scoped_lock(mutex_);
+      stop_ = true;
+    }
+    wakeup_.notify_one();
+    drainer_.join();
+  }
+
+  // -- Assignment
+
+  auto operator=(const async_log_sink&) -> async_log_sink& = delete;
+  auto operator=(async_log_sink&&) -> async_log_sink& = delete;
+
+  // -- Producers
+
+  // Every call adds a ring, which lives as long as the sink
+  [[nodiscard]] auto make_producer() -> producer {
+    auto lock = std::scoped_lock(rings_mutex_);
+    rings_.push_back(std::make_unique<producer_ring>(ring_capacity_));
+    return producer(*this, *rings_.back());
+  }
+
+  // -- Flushing
+
+  // Blocks until every record appended before the call is written or dropped
+  auto flush() -> void {
+    auto targets = std::vector<std::pair<producer_ring*, size_type>>();
+    {
+      auto lock = std::scoped_lock(rings_mutex_);
+      for (const auto& ring : rings_) {
+        targets.emplace_back(ring.get(), ring->tail.load(std::memory_order::acquire));
+      }
+    }
+
+    wake();
+    for (auto [ring, tail] : targets) {
+      for (auto head = ring->head.load(std::memory_order::acquire); head < tail;
+           head = ring->head.load(std::memory_order::acquire)) {
+        ring->head.wait(head, std::memory_order::acquire);
+      }
+    }
+  }
+
+  // -- Observers
+
+  [[nodiscard]] auto fd() const noexcept -> int { return fd_; }
+
+  [[nodiscard]] auto ring_capacity() const noexcept -> size_type { return ring_capacity_; }
+
+  // Records dropped by all producers so far
+  [[nodiscard]] auto dropped() const -> size_type {
+    auto lock = std::scoped_lock(rings_mutex_);
+    auto total = size_type{0};
+    for (const auto& ring : rings_) {
+      total += ring->dropped.load(std::memory_order::relaxed);
+    }
+    return total;
+  }
+
+  // First error of the background writes, the bytes of a failed write are dropped
+  [[nodiscard]] auto error() const noexcept -> std::error_code {
+    return {error_.load(std::memory_order::relaxed), std::system_category()};
+  }
+
+ private:
+  // -- Member types
+
+  struct producer_ring {
+    using ring_type = ranges::ring_view<std::span<std::byte>, ranges::ring_view_bound_t>;
+
+    [[nodiscard]] explicit producer_ring(size_type ring_capacity)
+        : data(std::make_unique_for_overwrite<std::byte[]>(ring_capacity)),  // NOLINT(*-c-arrays)
+          capacity(ring_capacity),
+          ends(is_overwrite_ ? std::max(ring_capacity / 16, size_type{16}) : 0) {}
+
+    // Producer side
+
+    [[nodiscard]] auto fits(size_type position, size_type size) noexcept -> bool {
+      if (capacity - (position - cached_head) >= size && !ends_full()) {
+        return true;
+      }
+      cached_head = head.load(std::memory_order::acquire);
+      return capacity - (position - cached_head) >= size && !ends_full();
+    }
+
+    auto copy(size_type position, std::span<const std::byte> record) noexcept -> void {
+      for (auto&& segment : ranges::ring_segments(bytes(position, record.size()))) {
+        const auto size = static_cast<size_type>(std::ranges::size(segment));
+        std::memcpy(std::to_address(std::ranges::begin(segment)), record.data(), size);
+        record = record.subspan(size);
+      }
+    }
+
+    // Drops the oldest record the background thread has not claimed, false if there is none
+    auto drop_oldest() noexcept -> bool {
+      auto first = start.load(std::memory_order::acquire);
+      forget_claimed(first);
+      if (ends.empty()) {
+        return false;
+      }
+
+      const auto last = ends.front();
+      if (!start.compare_exchange_strong(first, last, std::memory_order::acq_rel,
+                                         std::memory_order::acquire)) {
+        // Claimed in the meantime, so there is something else to look at
+        return true;
+      }
+      ends.pop_front();
+      count_drop();
+
+      // Nobody reads the dropped bytes, so they are free at once unless an earlier write is still
+      // in flight, and then they are freed together with it
+      head.compare_exchange_strong(first, last, std::memory_order::release,
+                                   std::memory_order::relaxed);
+      return true;
+    }
+
+    auto count_drop() noexcept -> void {
+      dropped.store(dropped.load(std::memory_order::relaxed) + 1, std::memory_order::relaxed);
+    }
+
+    // Background thread side
+
+    // Takes everything published away from the producer, returns the claimed range
+    [[nodiscard]] auto claim() noexcept -> std::pair<size_type, size_type> {
+      auto first = start.load(std::memory_order::acquire);
+      auto last = tail.load(std::memory_order::acquire);
+      while (first != last && !start.compare_exchange_weak(first, last, std::memory_order::acq_rel,
+                                                           std::memory_order::acquire)) {
+        last = tail.load(std::memory_order::acquire);
+      }
+      return {first, last};
+    }
+
+    auto add_segments(size_type first, size_type last, std::vector<::iovec>& out) const -> void {
+      for (auto&& segment : ranges::ring_segments(bytes(first, last - first))) {
+        out.push_back({std::to_address(std::ranges::begin(segment)),
+                       static_cast<size_type>(std::ranges::size(segment))});
+      }
+    }
+
+    auto release(size_type last) noexcept -> void {
+      detail::store_max(head, last, std::memory_order::release);
+      head.notify_all();
+    }
+
+    // Helper functions
+
+    // Count bytes from the free-running index position, at most two segments. Two laps are
+    // enough for any run which starts in the first one.
+    [[nodiscard]] auto bytes(size_type position, size_type count) const noexcept
+        -> std::ranges::subrange<ring_type::iterator_type> {
+      auto ring = ring_type(std::span(data.get(), capacity), 2);
+      const auto begin = ring.begin() + static_cast<std::ptrdiff_t>(position & (capacity - 1));
+      return {begin, begin + static_cast<std::ptrdiff_t>(count)};
+    }
+
+    [[nodiscard]] auto ends_full() noexcept -> bool {
+      if constexpr (is_overwrite_) {
+        if (ends.full()) {
+          forget_claimed(start.load(std::memory_order::acquire));
+        }
+        return ends.full();
+      } else {
+        return false;
+      }
+    }
+
+    auto forget_claimed(size_type first) noexcept -> void {
+      while (!ends.empty() && ends.front() <= first) {
+        ends.pop_front();
+      }
+    }
+
+    // Data members
+
+    // Read-only after construction
+    std::unique_ptr<std::byte[]> data = {};  // NOLINT(*-avoid-c-arrays)
+    size_type capacity = 0;
+
+    // Written by the producer only, ends of the records which may still be dropped
+    alignas(cache_line_size) std::atomic<size_type> tail = 0;
+    size_type cached_head = 0;
+    ring_buffer<size_type> ends = {};
+    std::atomic<size_type> dropped = 0;
+
+    alignas(cache_line_size) std::atomic<size_type> start = 0;
+    alignas(cache_line_size) std::atomic<size_type> head = 0;
+  };
+
+  // -- Helper functions
+
+  auto append(producer_ring& ring, std::span<const std::byte> record) -> bool {
+    const auto size = record.size();
+    if (size == 0) {
+      return true;
+    }
+    if (size > ring_capacity_) {
+      ring.count_drop();
+      return false;
+    }
+
+    const auto tail = ring.tail.load(std::memory_order::relaxed);
+    while (!ring.fits(tail, size)) {
+      if constexpr (is_overwrite_) {
+        if (ring.drop_oldest()) {
+          continue;
+        }
+      }
+      if constexpr (is_block_ || is_overwrite_) {
+        wake();
+        ring.head.wait(ring.cached_head, std::memory_order::acquire);
+      } else {
+        ring.count_drop();
+        return false;
+      }
+    }
+
+    ring.copy(tail, record);
+    if constexpr (is_overwrite_) {
+      ring.ends.push_back(tail + size);
+    }
+    ring.tail.store(tail + size, std::memory_order::release);
+    return true;
+  }
+
+  auto wake() -> void {
+    {
+      auto lock = std::scoped_lock(mutex_);
+      wake_ = true;
+    }
+    wakeup_.notify_one();
+  }
+
+  // Background thread
+  auto run() -> void {
+    auto lock = std::unique_lock(mutex_);
+    while (true) {
+      wake_ = false;
+      lock.unlock();
+      const auto written = drain();
+      lock.lock();
+
+      if (written == 0) {
+        if (stop_) {
+          return;
+        }
+        wakeup_.wait_for(lock, flush_interval_, [this] { return stop_ || wake_; });
+      }
+    }
+  }
+
+  // Claims everything published in all rings and writes it out, returns the number of bytes
+  auto drain() -> size_type {
+    {
+      auto lock = std::scoped_lock(rings_mutex_);
+      batch_rings_.clear();
+      for (const auto& ring : rings_) {
+        batch_rings_.push_back(ring.get());
+      }
+    }
+
+    batch_claims_.clear();
+    batch_segments_.clear();
+    auto total = size_type{0};
+    for (auto* ring : batch_rings_) {
+      const auto [first, last] = ring->claim();
+      if (first == last) {
+        // Records dropped after the last claim are free as well
+        if (ring->head.load(std::memory_order::relaxed) < first) {
+          ring->release(first);
+        }
+        continue;
+      }
+      ring->add_segments(first, last, batch_segments_);
+      batch_claims_.emplace_back(ring, last);
+      total += last - first;
+    }
+
+    write_all(batch_segments_);
+    for (auto [ring, last] : batch_claims_) {
+      ring->release(last);
+    }
+    return total;
+  }
+
+  auto write_all(std::span<::iovec> segments) noexcept -> void {
+    while (!segments.empty()) {
+      const auto count = std::min(segments.size(), std::size_t{IOV_MAX});
+      const auto written = ::writev(fd_, segments.data(), static_cast<int>(count));
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        auto expected = 0;
+        error_.compare_exchange_strong(expected, errno, std::memory_order::relaxed);
+        return;
+      }
+
+      // Skip what has been written, a short write leaves the rest of a segment
+      auto left = static_cast<std::size_t>(written);
+      while (!segments.empty() && left >= segments.front().iov_len) {
+        left -= segments.front().iov_len;
+        segments = segments.subspan(1);
+      }
+      if (left != 0) {
+        auto& segment = segments.front();
+        segment.iov_base = static_cast<std::byte*>(segment.iov_base) + left;  // NOLINT(*-pointer-*)
+        segment.iov_len -= left;
+      }
+    }
+  }
+
+  // -- Data members
+
+  int fd_ = -1;
+  size_type ring_capacity_ = 0;
+  duration_type flush_interval_ = {};
+  std::atomic<int> error_ = 0;
+
+  mutable std::mutex rings_mutex_ = {};
+  std::vector<std::unique_ptr<producer_ring>> rings_ = {};
+
+  std::mutex mutex_ = {};
+  std::condition_variable wakeup_ = {};
+  bool wake_ = false;
+  bool stop_ = false;
+
+  // Used by the background thread only, kept to reuse the allocations
+  std::vector<producer_ring*> batch_rings_ = {};
+  std::vector<std::pair<producer_ring*, size_type>> batch_claims_ = {};
+  std::vector<::iovec> batch_segments_ = {};
+
+  std::thread drainer_ = {};
+};
+
+}  // namespace dlgr
@@ -0,0 +1,238 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <gsl/assert>
+
+#include <dlgr/cache_line.h>
+#include <dlgr/ring_view.h>
+
+namespace dlgr {
+
+// == broadcast_ring implementation
+
+// Bounded ring where every element published by one producer thread is read by each of a fixed
+// number of consumer threads, in the manner of the LMAX Disruptor. Slots are constructed once and
+// overwritten in place, nothing is copied per consumer.
+//
+// The producer publishes by moving a free-running cursor and may only run a capacity ahead of the
+// slowest consumer, each consumer moves a sequence of its own when it is done with a batch. Every
+// index lives on its own cache line. Batches are ring_view subranges, so both sides touch the
+// slots with plain loads and stores and only the cursors are atomic.
+template <class ValueType, class Allocator = std::allocator<ValueType>>
+  requires std::default_initializable<ValueType> && std::movable<ValueType>
+class broadcast_ring {
+ public:
+  // -- Member types
+
+  using value_type = ValueType;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using ring_type = ranges::ring_view<std::span<value_type>, ranges::ring_view_bound_t>;
+  using const_ring_type =
+      ranges::ring_view<std::span<const value_type>, ranges::ring_view_bound_t>;
+
+  // Slots claimed by the producer, to be filled and then published
+  using claim_type = std::ranges::subrange<typename ring_type::iterator_type>;
+
+  // Published elements a consumer has not released yet
+  using batch_type = std::ranges::subrange<typename const_ring_type::iterator_type>;
+
+  // Handle of one consumer, for one thread at a time, must not outlive the ring
+  class consumer {
+   public:
+    [[nodiscard]] consumer() noexcept = default;
+
+    // Everything published and not released yet, possibly empty
+    [[nodiscard]] auto available() -> batch_type {
+      const auto head = sequence().load(std::memory_order::relaxed);
+      cached_tail_ = ring_->tail_.load(std::memory_order::acquire);
+      return ring_->batch(head, cached_tail_ - head);
+    }
+
+    // Same as available(), but waits until it is not empty
+    [[nodiscard]] auto wait() -> batch_type {
+      auto batch = available();
+      while (batch.empty()) {
+        ring_->tail_.wait(cached_tail_, std::memory_order::acquire);
+        batch = available();
+      }
+      return batch;
+    }
+
+    // Hands the first count elements of the batch back to the producer
+    auto release(size_type count) noexcept -> void {
+      auto& seq = sequence();
+      const auto head = seq.load(std::memory_order::relaxed);
+      Expects(count <= cached_tail_ - head);
+      seq.store(head + count, std::memory_order::release);
+      seq.notify_one();
+    }
+
+    [[nodiscard]] auto index() const noexcept -> size_type { return index_; }
+
+   private:
+    friend class broadcast_ring;
+
+    [[nodiscard]] consumer(broadcast_ring& ring, size_type index) noexcept
+        : ring_(&ring),
+          index_(index),
+          cached_tail_(ring.sequences_[index].value.load(std::memory_order::relaxed)) {}
+
+    [[nodiscard]] auto sequence() const noexcept -> std::atomic<size_type>& {
+      return ring_->sequences_[index_].value;
+    }
+
+    broadcast_ring* ring_ = nullptr;
+    size_type index_ = 0;
+    size_type cached_tail_ = 0;
+  };
+
+  // -- Constructors
+
+  // Capacity is rounded up to a power of two
+  [[nodiscard]] broadcast_ring(size_type min_capacity, size_type consumers_count,
+                               const allocator_type& alloc = allocator_type())
+      : slots_(std::bit_ceil(std::max(min_capacity, size_type{1})), alloc),
+        ring_(std::span(slots_), 2),
+        const_ring_(std::span<const value_type>(slots_), 2),
+        sequences_(consumers_count) {
+    Expects(consumers_count > 0);
+  }
+
+  broadcast_ring(const broadcast_ring&) = delete;
+  broadcast_ring(broadcast_ring&&) = delete;
+
+  // -- Destructor
+
+  ~broadcast_ring() noexcept = default;
+
+  // -- Assignment
+
+  auto operator=(const broadcast_ring&) -> broadcast_ring& = delete;
+  auto operator=(broadcast_ring&&) -> broadcast_ring& = delete;
+
+  // -- Capacity
+
+  [[nodiscard]] auto capacity() const noexcept -> size_type { return slots_.size(); }
+
+  [[nodiscard]] auto consumers_count() const noexcept -> size_type { return sequences_.size(); }
+
+  // -- Producer side
+
+  // Claims up to count free slots, fewer (even none) if the slowest consumer is not far enough.
+  // Slots claimed earlier and not published yet are claimed again.
+  [[nodiscard]] auto try_claim(size_type count) -> claim_type {
+    const auto tail = tail_.load(std::memory_order::relaxed);
+    if (capacity() - (tail - cached_min_head_) < count) {
+      cached_min_head_ = min_head();
+    }
+    claimed_ = std::min(count, capacity() - (tail - cached_min_head_));
+    return claim(tail, claimed_);
+  }
+
+  // Same as try_claim(), but waits until all count slots are free
+  [[nodiscard]] auto claim(size_type count) -> claim_type {
+    Expects(count <= capacity());
+    auto slots = try_claim(count);
+    while (slots.size() < count) {
+      wait_for_slowest();
+      slots = try_claim(count);
+    }
+    return slots;
+  }
+
+  // Makes the first count claimed slots visible to the consumers
+  auto publish(size_type count) noexcept -> void {
+    Expects(count <= claimed_);
+    claimed_ = 0;
+    tail_.store(tail_.load(std::memory_order::relaxed) + count, std::memory_order::release);
+    tail_.notify_all();
+  }
+
+  auto try_push(value_type value) -> bool {
+    auto slots = try_claim(1);
+    if (slots.empty()) {
+      return false;
+    }
+    slots.front() = std::move(value);
+    publish(1);
+    return true;
+  }
+
+  auto push(value_type value) -> void {
+    claim(1).front() = std::move(value);
+    publish(1);
+  }
+
+  // -- Consumer side
+
+  [[nodiscard]] auto make_consumer(size_type index) noexcept -> consumer {
+    Expects(index < consumers_count());
+    return consumer(*this, index);
+  }
+
+ private:
+  // -- Member types
+
+  struct alignas(cache_line_size) padded_sequence {
+    std::atomic<size_type> value = 0;
+  };
+
+  // -- Helper functions
+
+  [[nodiscard]] auto claim(size_type tail, size_type count) -> claim_type {
+    const auto first = ring_.begin() + static_cast<std::ptrdiff_t>(tail & (capacity() - 1));
+    return {first, first + static_cast<std::ptrdiff_t>(count)};
+  }
+
+  [[nodiscard]] auto batch(size_type head, size_type count) -> batch_type {
+    const auto first = const_ring_.begin() + static_cast<std::ptrdiff_t>(head & (capacity() - 1));
+    return {first, first + static_cast<std::ptrdiff_t>(count)};
+  }
+
+  [[nodiscard]] auto min_head() const noexcept -> size_type {
+    auto head = std::numeric_limits<size_type>::max();
+    for (const auto& seq : sequences_) {
+      head = std::min(head, seq.value.load(std::memory_order::acquire));
+    }
+    return head;
+  }
+
+  auto wait_for_slowest() noexcept -> void {
+    for (auto& seq : sequences_) {
+      if (seq.value.load(std::memory_order::acquire) == cached_min_head_) {
+        seq.value.wait(cached_min_head_, std::memory_order::acquire);
+        return;
+      }
+    }
+  }
+
+  // -- Data members
+
+  // Read-only after construction, apart from the slot contents and the consumer sequences, which
+  // get a cache line each
+  std::vector<value_type, allocator_type> slots_;
+  ring_type ring_;
+  const_ring_type const_ring_;
+  std::vector<padded_sequence> sequences_;
+
+  // Written by the producer only
+  alignas(cache_line_size) std::atomic<size_type> tail_ = 0;
+  size_type cached_min_head_ = 0;
+  size_type claimed_ = 0;
+};
+
+}  // namespace dlgr
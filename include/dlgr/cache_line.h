@@ -0,0 +1,14 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#pragma once
+
+#include <cstddef>
+
+namespace dlgr {
+
+// Alignment which keeps data written by different threads on separate cache lines.
+// std::hardware_destructive_interference_size is not used because its value may differ between
+// translation units compiled with different flags, so it is unsafe in headers.
+inline constexpr std::size_t cache_line_size = 64;
+
+}  // namespace dlgr
@@ -0,0 +1,206 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <gsl/assert>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace dlgr {
+
+// == Implementation details
+
+namespace detail {
+
+// High half of the full-width product of two unsigned integers
+template <std::unsigned_integral UInteger>
+[[nodiscard]] constexpr auto mul_high(UInteger lhs, UInteger rhs) noexcept -> UInteger {
+  constexpr auto digits = std::numeric_limits<UInteger>::digits;
+  if constexpr (digits <= 32) {
+    return static_cast<UInteger>((std::uint64_t{lhs} * std::uint64_t{rhs}) >> digits);
+  } else {
+    static_assert(digits == 64);
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128_t;  // NOLINT(modernize-use-using)
+    return static_cast<UInteger>((uint128_t{lhs} * uint128_t{rhs}) >> 64U);
+#else
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+    if (!std::is_constant_evaluated()) {
+      return __umulh(lhs, rhs);
+    }
+#endif
+    constexpr auto half_mask = std::uint64_t{0xFFFF'FFFF};
+    const auto lhs_lo = lhs & half_mask;
+    const auto lhs_hi = lhs >> 32U;
+    const auto rhs_lo = rhs & half_mask;
+    const auto rhs_hi = rhs >> 32U;
+    const auto lo_lo = lhs_lo * rhs_lo;
+    const auto hi_lo = lhs_hi * rhs_lo;
+    const auto lo_hi = lhs_lo * rhs_hi;
+    const auto cross = (lo_lo >> 32U) + (hi_lo & half_mask) + lo_hi;
+    return lhs_hi * rhs_hi + (hi_lo >> 32U) + (cross >> 32U);
+#endif
+  }
+}
+
+// Quotient and remainder of (high * 2^digits) / divisor, where high < divisor
+template <std::unsigned_integral UInteger>
+[[nodiscard]] constexpr auto div_wide(UInteger high, UInteger divisor, UInteger& rem) noexcept
+    -> UInteger {
+  GSL_ASSUME(high < divisor);
+
+  constexpr auto digits = std::numeric_limits<UInteger>::digits;
+  if constexpr (digits <= 32) {
+    const auto num = std::uint64_t{high} << static_cast<unsigned>(digits);
+    rem = static_cast<UInteger>(num % divisor);
+    return static_cast<UInteger>(num / divisor);
+  } else {
+    static_assert(digits == 64);
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128_t;  // NOLINT(modernize-use-using)
+    const auto num = uint128_t{high} << 64U;
+    rem = static_cast<UInteger>(num % divisor);
+    return static_cast<UInteger>(num / divisor);
+#else
+    auto quot = UInteger{};
+    for (auto bit = 0; bit < digits; ++bit) {
+      const auto carry = (high >> (digits - 1)) != 0;
+      high = static_cast<UInteger>(high << 1U);
+      quot = static_cast<UInteger>(quot << 1U);
+      if (carry || high >= divisor) {
+        high = static_cast<UInteger>(high - divisor);
+        quot |= 1U;
+      }
+    }
+    rem = high;
+    return quot;
+#endif
+  }
+}
+
+}  // namespace detail
+
+// == fast_divisor implementation
+
+// Precomputed divisor which replaces hardware division of non-negative numerators by a multiply
+// and a shift (or by a single shift and mask when the divisor is a power of two).
+template <std::integral IntegerType>
+class fast_divisor {
+ public:
+  // -- Member types
+
+  using value_type = IntegerType;
+  using unsigned_type = std::make_unsigned_t<value_type>;
+
+  struct div_result {
+    value_type quot = {};
+    value_type rem = {};
+  };
+
+  // -- Constructors
+
+  [[nodiscard]] constexpr fast_divisor() noexcept = default;
+
+  [[nodiscard]] constexpr explicit fast_divisor(value_type divisor) noexcept
+      : divisor_(static_cast<unsigned_type>(divisor)) {
+    Expects(divisor > 0);
+
+    constexpr auto digits = std::numeric_limits<unsigned_type>::digits;
+    const auto log2_floor = static_cast<std::uint8_t>(digits - 1 - std::countl_zero(divisor_));
+
+    if (std::has_single_bit(divisor_)) {
+      shift_ = log2_floor;
+      return;
+    }
+
+    const auto power = static_cast<unsigned_type>(unsigned_type{1} << log2_floor);
+    auto rem = unsigned_type{};
+    auto magic = detail::div_wide(power, divisor_, rem);
+
+    if (divisor_ - rem < power) {
+      shift_ = log2_floor;
+    } else {
+      // The magic number needs one more bit, so the quotient is fixed up in div()
+      magic = static_cast<unsigned_type>(magic + magic);
+      const auto twice_rem = static_cast<unsigned_type>(rem + rem);
+      if (twice_rem >= divisor_ || twice_rem < rem) {
+        ++magic;
+      }
+      shift_ = log2_floor;
+      add_ = true;
+    }
+
+    magic_ = static_cast<unsigned_type>(magic + 1U);
+  }
+
+  // -- Comparison
+
+  [[nodiscard]] constexpr auto operator==(const fast_divisor& other) const noexcept -> bool {
+    return divisor_ == other.divisor_;
+  }
+
+  // -- Access
+
+  [[nodiscard]] constexpr auto value() const noexcept -> value_type {
+    return static_cast<value_type>(divisor_);
+  }
+
+  [[nodiscard]] constexpr auto is_power_of_two() const noexcept -> bool { return magic_ == 0; }
+
+  // -- Operations
+
+  [[nodiscard]] constexpr auto div(value_type num) const noexcept -> value_type {
+    GSL_ASSUME(num >= 0);
+    GSL_ASSUME(divisor_ != 0);
+
+    const auto unum = static_cast<unsigned_type>(num);
+    if (is_power_of_two()) {
+      return static_cast<value_type>(unum >> shift_);
+    }
+
+    const auto quot = detail::mul_high(magic_, unum);
+    if (add_) {
+      const auto fixed = static_cast<unsigned_type>(((unum - quot) >> 1U) + quot);
+      return static_cast<value_type>(fixed >> shift_);
+    }
+    return static_cast<value_type>(quot >> shift_);
+  }
+
+  [[nodiscard]] constexpr auto mod(value_type num) const noexcept -> value_type {
+    return div_mod(num).rem;
+  }
+
+  [[nodiscard]] constexpr auto div_mod(value_type num) const noexcept -> div_result {
+    GSL_ASSUME(num >= 0);
+
+    if (is_power_of_two()) {
+      const auto unum = static_cast<unsigned_type>(num);
+      return {
+          .quot = static_cast<value_type>(unum >> shift_),
+          .rem = static_cast<value_type>(unum & (divisor_ - 1U)),
+      };
+    }
+
+    const auto quot = div(num);
+    return {
+        .quot = quot,
+        .rem = static_cast<value_type>(num - quot * static_cast<value_type>(divisor_)),
+    };
+  }
+
+ private:
+  unsigned_type divisor_ = {};
+  unsigned_type magic_ = {};
+  std::uint8_t shift_ = {};
+  bool add_ = false;
+};
+
+}  // namespace dlgr
@@ -0,0 +1,277 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#pragma once
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "dlgr/fd_ring_reader.h requires POSIX (readv)"
+#endif
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <climits>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <gsl/assert>
+
+#include <dlgr/ring_view.h>
+
+namespace dlgr {
+
+// == fd_ring_frame implementation
+
+// Payload of one frame held by an fd_ring_reader, pointing straight into the reader storage. Stays
+// valid across refills until it is released.
+class fd_ring_frame {
+ public:
+  // -- Member types
+
+  using size_type = std::size_t;
+  using span_type = std::span<const std::byte>;
+  using ring_type = ranges::ring_view<span_type, ranges::ring_view_bound_t>;
+  using bytes_type = std::ranges::subrange<typename ring_type::iterator_type>;
+
+  // -- Constructors
+
+  [[nodiscard]] fd_ring_frame() noexcept = default;
+
+  // Bytes of the payload and the size of the whole frame, prefix included
+  [[nodiscard]] fd_ring_frame(bytes_type bytes, size_type wire_size) noexcept
+      : bytes_(std::move(bytes)), wire_size_(wire_size) {}
+
+  // -- Access
+
+  // Payload as a ring_view subrange, which is fine whether the frame crosses the seam or not
+  [[nodiscard]] auto bytes() const noexcept -> const bytes_type& { return bytes_; }
+
+  // Payload as one span, or nothing if it crosses the end of the storage
+  [[nodiscard]] auto contiguous() const noexcept -> std::optional<span_type> {
+    if (bytes_.empty()) {
+      return span_type();
+    }
+    const auto* first = &*bytes_.begin();
+    const auto* last = &*std::ranges::prev(bytes_.end());
+    if (last < first) {
+      return std::nullopt;
+    }
+    return span_type(first, bytes_.size());
+  }
+
+  [[nodiscard]] auto size() const noexcept -> size_type { return bytes_.size(); }
+
+  [[nodiscard]] auto empty() const noexcept -> bool { return bytes_.empty(); }
+
+  [[nodiscard]] auto wire_size() const noexcept -> size_type { return wire_size_; }
+
+ private:
+  // -- Data members
+
+  bytes_type bytes_ = {};
+  size_type wire_size_ = 0;
+};
+
+// == fd_ring_reader implementation
+
+// Fixed-capacity byte ring fed from a file descriptor. Every fill() is a single readv() into both
+// free segments of the storage, and frames are handed out in place instead of being copied out
+// first. The descriptor is borrowed, not closed.
+class fd_ring_reader {
+ public:
+  // -- Member types
+
+  using size_type = std::size_t;
+  using span_type = std::span<const std::byte>;
+  using frame_type = fd_ring_frame;
+
+  // -- Constructors
+
+  [[nodiscard]] fd_ring_reader() noexcept = default;
+
+  [[nodiscard]] fd_ring_reader(int fd, size_type capacity)
+      : data_(std::make_unique_for_overwrite<std::byte[]>(capacity)),  // NOLINT(*-avoid-c-arrays)
+        fd_(fd),
+        capacity_(capacity) {
+    Expects(capacity > 0);
+  }
+
+  fd_ring_reader(const fd_ring_reader&) = delete;
+
+  [[nodiscard]] fd_ring_reader(fd_ring_reader&& other) noexcept
+      : data_(std::move(other.data_)),
+        fd_(std::exchange(other.fd_, -1)),
+        capacity_(std::exchange(other.capacity_, 0)),
+        head_(std::exchange(other.head_, 0)),
+        size_(std::exchange(other.size_, 0)),
+        eof_(std::exchange(other.eof_, false)) {}
+
+  // -- Destructor
+
+  ~fd_ring_reader() noexcept = default;
+
+  // -- Assignment
+
+  auto operator=(const fd_ring_reader&) -> fd_ring_reader& = delete;
+
+  auto operator=(fd_ring_reader&& other) noexcept -> fd_ring_reader& {
+    if (this != &other) {
+      data_ = std::move(other.data_);
+      fd_ = std::exchange(other.fd_, -1);
+      capacity_ = std::exchange(other.capacity_, 0);
+      head_ = std::exchange(other.head_, 0);
+      size_ = std::exchange(other.size_, 0);
+      eof_ = std::exchange(other.eof_, false);
+    }
+    return *this;
+  }
+
+  // -- Capacity
+
+  [[nodiscard]] auto fd() const noexcept -> int { return fd_; }
+
+  // Bytes read but not released yet
+  [[nodiscard]] auto size() const noexcept -> size_type { return size_; }
+
+  [[nodiscard]] auto capacity() const noexcept -> size_type { return capacity_; }
+
+  [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; }
+
+  [[nodiscard]] auto full() const noexcept -> bool { return size_ == capacity_; }
+
+  // Whether a read has hit the end of the file
+  [[nodiscard]] auto eof() const noexcept -> bool { return eof_; }
+
+  // -- Reading
+
+  // Reads as much as fits with one readv() and returns the number of bytes read. Returns 0 if the
+  // storage is full, at the end of the file and if a non-blocking descriptor has nothing to read.
+  auto fill() -> size_type {
+    if (full() || eof_) {
+      return 0;
+    }
+
+    auto segments = std::array<::iovec, 2>{};
+    const auto count = free_segments(segments);
+
+    auto result = ::ssize_t{0};
+    do {
+      result = ::readv(fd_, segments.data(), count);
+    } while (result < 0 && errno == EINTR);
+
+    if (result < 0) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK) {
+        return 0;
+      }
+      throw std::system_error(errno, std::system_category(), "readv");
+    }
+    if (result == 0) {
+      eof_ = true;
+    }
+
+    size_ += static_cast<size_type>(result);
+    return static_cast<size_type>(result);
+  }
+
+  // -- Access
+
+  // All unreleased bytes, split at the end of the storage
+  [[nodiscard]] auto as_spans() const noexcept -> std::array<span_type, 2> {
+    const auto first = std::min(size_, capacity_ - head_);
+    return {span_type(data_.get() + head_, first),  // NOLINT(*-pointer-arithmetic)
+            span_type(data_.get(), size_ - first)};
+  }
+
+  // Count unreleased bytes starting at offset, in place
+  [[nodiscard]] auto bytes(size_type offset, size_type count) const -> frame_type::bytes_type {
+    Expects(offset <= size_ && count <= size_ - offset);
+    // Two laps are enough for any run which starts in the first one
+    auto ring = frame_type::ring_type(span_type(data_.get(), capacity_), 2);
+    const auto first = ring.begin() + static_cast<std::ptrdiff_t>(head_ + offset);
+    return {first, first + static_cast<std::ptrdiff_t>(count)};
+  }
+
+  // Frame at the tail made of a LengthType prefix in the given byte order and that many bytes of
+  // payload, or nothing if it is not read in full yet. Throws std::length_error if the frame could
+  // never fit into the storage.
+  template <std::unsigned_integral LengthType, std::endian Order = std::endian::little>
+  [[nodiscard]] auto next_frame() const -> std::optional<frame_type> {
+    constexpr auto prefix_size = sizeof(LengthType);
+    if (size_ < prefix_size) {
+      return std::nullopt;
+    }
+
+    auto length = LengthType{0};
+    for (auto idx = size_type{0}; idx < prefix_size; ++idx) {
+      const auto shift = (Order == std::endian::little ? idx : prefix_size - 1 - idx) * CHAR_BIT;
+      length |= static_cast<LengthType>(std::to_integer<LengthType>(at(idx)) << shift);
+    }
+
+    if (length > capacity_ - std::min(capacity_, prefix_size)) {
+      throw std::length_error("frame is larger than the reader");
+    }
+    const auto wire_size = prefix_size + static_cast<size_type>(length);
+    if (size_ < wire_size) {
+      return std::nullopt;
+    }
+    return frame_type(bytes(prefix_size, length), wire_size);
+  }
+
+  // -- Modification
+
+  // Drops count bytes at the tail, making room for the next fill()
+  auto release(size_type count) noexcept -> void {
+    Expects(count <= size_);
+    head_ += count;
+    if (head_ >= capacity_) {
+      head_ -= capacity_;
+    }
+    size_ -= count;
+  }
+
+  // Drops the frame, which must be the one at the tail
+  auto release(const frame_type& frame) noexcept -> void { release(frame.wire_size()); }
+
+ private:
+  // -- Helper functions
+
+  [[nodiscard]] auto at(size_type offset) const noexcept -> std::byte {
+    const auto index = head_ + offset;
+    // NOLINTNEXTLINE(*-pointer-arithmetic)
+    return data_[index < capacity_ ? index : index - capacity_];
+  }
+
+  // Free space after the last byte as up to two segments, returns how many are used
+  auto free_segments(std::array<::iovec, 2>& segments) const noexcept -> int {
+    const auto tail = head_ + size_ < capacity_ ? head_ + size_ : head_ + size_ - capacity_;
+    const auto free = capacity_ - size_;
+    const auto first = std::min(free, capacity_ - tail);
+    segments[0] = {data_.get() + tail, first};  // NOLINT(*-pointer-arithmetic)
+    if (first == free) {
+      return 1;
+    }
+    segments[1] = {data_.get(), free - first};
+    return 2;
+  }
+
+  // -- Data members
+
+  std::unique_ptr<std::byte[]> data_ = {};  // NOLINT(*-avoid-c-arrays)
+  int fd_ = -1;
+  size_type capacity_ = 0;
+  size_type head_ = 0;
+  size_type size_ = 0;
+  bool eof_ = false;
+};
+
+}  // namespace dlgr
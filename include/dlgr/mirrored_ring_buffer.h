@@ -0,0 +1,320 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#pragma once
+
+#if !defined(__linux__)
+#error "dlgr/mirrored_ring_buffer.h requires Linux (memfd_create)"
+#endif
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <numeric>
+#include <span>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <gsl/assert>
+
+namespace dlgr {
+
+// == Implementation details
+
+namespace detail {
+
+// The same memory file mapped twice back to back, so a write past the end of the first half
+// lands at the beginning of it
+class mirrored_mapping {
+ public:
+  // -- Constructors
+
+  [[nodiscard]] mirrored_mapping() noexcept = default;
+
+  // Size must be a multiple of the page size
+  [[nodiscard]] explicit mirrored_mapping(std::size_t size) : size_(size) {
+    Expects(size % page_size() == 0);
+
+    // NOLINTNEXTLINE(hicpp-signed-bitwise): Flags are ints in the C API
+    const auto file = ::memfd_create("dlgr_mirrored_ring", MFD_CLOEXEC);
+    if (file < 0) {
+      throw_errno("memfd_create");
+    }
+
+    auto fail = [&](const char* what) {
+      const auto error = errno;
+      if (data_ != nullptr) {
+        ::munmap(data_, 2 * size_);
+        data_ = nullptr;
+      }
+      ::close(file);
+      throw std::system_error(error, std::system_category(), what);
+    };
+
+    if (::ftruncate(file, static_cast<::off_t>(size_)) != 0) {
+      fail("ftruncate");
+    }
+
+    // Reserve the address range for both halves first, so nothing else can take the second one
+    // NOLINTNEXTLINE(hicpp-signed-bitwise): Flags are ints in the C API
+    auto* reserved = ::mmap(nullptr, 2 * size_, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (reserved == MAP_FAILED) {
+      fail("mmap");
+    }
+    data_ = static_cast<std::byte*>(reserved);
+
+    for (auto* half : {data_, data_ + size_}) {  // NOLINT(*-pointer-arithmetic)
+      // NOLINTNEXTLINE(hicpp-signed-bitwise): Flags are ints in the C API
+      auto* mapped = ::mmap(half, size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, file, 0);
+      if (mapped == MAP_FAILED) {
+        fail("mmap");
+      }
+    }
+
+    // The mappings keep the memory file alive
+    ::close(file);
+  }
+
+  mirrored_mapping(const mirrored_mapping&) = delete;
+
+  [[nodiscard]] mirrored_mapping(mirrored_mapping&& other) noexcept
+      : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+  // -- Destructor
+
+  ~mirrored_mapping() noexcept {
+    if (data_ != nullptr) {
+      ::munmap(data_, 2 * size_);
+    }
+  }
+
+  // -- Assignment
+
+  auto operator=(const mirrored_mapping&) -> mirrored_mapping& = delete;
+
+  auto operator=(mirrored_mapping&& other) noexcept -> mirrored_mapping& {
+    auto moved = mirrored_mapping(std::move(other));
+    std::swap(data_, moved.data_);
+    std::swap(size_, moved.size_);
+    return *this;
+  }
+
+  // -- Access
+
+  [[nodiscard]] auto data() const noexcept -> std::byte* { return data_; }
+
+  // Size of one half
+  [[nodiscard]] auto size() const noexcept -> std::size_t { return size_; }
+
+  [[nodiscard]] static auto page_size() noexcept -> std::size_t {
+    static const auto size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    return size;
+  }
+
+ private:
+  [[noreturn]] static auto throw_errno(const char* what) -> void {
+    throw std::system_error(errno, std::system_category(), what);
+  }
+
+  std::byte* data_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+}  // namespace detail
+
+// == mirrored_ring_buffer implementation
+
+// Fixed-capacity FIFO whose storage is mapped twice back to back, so the stored elements (and the
+// free space) are always one contiguous span and iterators are plain pointers without any wrap
+// check. Capacity is rounded up to whole pages, elements must be trivially copyable.
+template <class ValueType>
+  requires std::is_trivially_copyable_v<ValueType>
+class mirrored_ring_buffer {
+ public:
+  // -- Member types
+
+  using value_type = ValueType;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = value_type*;
+  using const_iterator = const value_type*;
+  using span_type = std::span<value_type>;
+  using const_span_type = std::span<const value_type>;
+
+  // -- Constructors
+
+  [[nodiscard]] mirrored_ring_buffer() noexcept = default;
+
+  [[nodiscard]] explicit mirrored_ring_buffer(size_type min_capacity)
+      : mapping_(mapping_size(min_capacity)), capacity_(mapping_.size() / sizeof(value_type)) {}
+
+  mirrored_ring_buffer(const mirrored_ring_buffer&) = delete;
+
+  [[nodiscard]] mirrored_ring_buffer(mirrored_ring_buffer&& other) noexcept
+      : mapping_(std::move(other.mapping_)),
+        capacity_(std::exchange(other.capacity_, 0)),
+        head_(std::exchange(other.head_, 0)),
+        size_(std::exchange(other.size_, 0)) {}
+
+  // -- Destructor
+
+  ~mirrored_ring_buffer() noexcept = default;
+
+  // -- Assignment
+
+  auto operator=(const mirrored_ring_buffer&) -> mirrored_ring_buffer& = delete;
+
+  auto operator=(mirrored_ring_buffer&& other) noexcept -> mirrored_ring_buffer& {
+    if (this != &other) {
+      mapping_ = std::move(other.mapping_);
+      capacity_ = std::exchange(other.capacity_, 0);
+      head_ = std::exchange(other.head_, 0);
+      size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+  }
+
+  // -- Iterators
+
+  [[nodiscard]] auto begin() noexcept -> iterator {
+    return data() + head_;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
+  [[nodiscard]] auto begin() const noexcept -> const_iterator {
+    return data() + head_;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
+  [[nodiscard]] auto end() noexcept -> iterator {
+    return begin() + size_;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
+  [[nodiscard]] auto end() const noexcept -> const_iterator {
+    return begin() + size_;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
+  // -- Capacity
+
+  [[nodiscard]] auto size() const noexcept -> size_type { return size_; }
+
+  [[nodiscard]] auto capacity() const noexcept -> size_type { return capacity_; }
+
+  [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; }
+
+  [[nodiscard]] auto full() const noexcept -> bool { return size_ == capacity_; }
+
+  // -- Element access
+
+  [[nodiscard]] auto operator[](size_type index) noexcept -> reference {
+    Expects(index < size_);
+    return begin()[index];  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
+  [[nodiscard]] auto operator[](size_type index) const noexcept -> const_reference {
+    Expects(index < size_);
+    return begin()[index];  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
+  [[nodiscard]] auto front() noexcept -> reference { return (*this)[0]; }
+
+  [[nodiscard]] auto front() const noexcept -> const_reference { return (*this)[0]; }
+
+  [[nodiscard]] auto back() noexcept -> reference { return (*this)[size_ - 1]; }
+
+  [[nodiscard]] auto back() const noexcept -> const_reference { return (*this)[size_ - 1]; }
+
+  // All stored elements, in FIFO order
+  [[nodiscard]] auto as_span() noexcept -> span_type { return {begin(), size_}; }
+
+  [[nodiscard]] auto as_span() const noexcept -> const_span_type { return {begin(), size_}; }
+
+  // Free space after the last element, to be filled in place and then published with commit()
+  [[nodiscard]] auto free_span() noexcept -> span_type { return {end(), capacity_ - size_}; }
+
+  // -- Modification
+
+  // Returns false if the buffer is full
+  auto push_back(const value_type& value) noexcept -> bool {
+    if (full()) {
+      return false;
+    }
+    *end() = value;
+    ++size_;
+    return true;
+  }
+
+  // Appends the longest prefix of values which fits and returns its size
+  auto push_n(const_span_type values) noexcept -> size_type {
+    const auto count = std::min(values.size(), capacity_ - size_);
+    if (count != 0) {
+      std::memcpy(end(), values.data(), count * sizeof(value_type));
+    }
+    size_ += count;
+    return count;
+  }
+
+  // Moves up to out.size() front elements into out and returns how many were moved
+  auto pop_n(span_type out) noexcept -> size_type {
+    const auto count = std::min(out.size(), size_);
+    if (count != 0) {
+      std::memcpy(out.data(), begin(), count * sizeof(value_type));
+    }
+    consume(count);
+    return count;
+  }
+
+  auto pop_front() noexcept -> void {
+    Expects(!empty());
+    consume(1);
+  }
+
+  // Publishes count elements written into free_span()
+  auto commit(size_type count) noexcept -> void {
+    Expects(count <= capacity_ - size_);
+    size_ += count;
+  }
+
+  // Drops count front elements
+  auto consume(size_type count) noexcept -> void {
+    Expects(count <= size_);
+    head_ += count;
+    if (head_ >= capacity_) {
+      head_ -= capacity_;
+    }
+    size_ -= count;
+  }
+
+  auto clear() noexcept -> void {
+    head_ = 0;
+    size_ = 0;
+  }
+
+ private:
+  // -- Helper functions
+
+  [[nodiscard]] static auto mapping_size(size_type min_capacity) -> size_type {
+    // Both the page size and the element size must divide the size of one half
+    const auto granule = std::lcm(detail::mirrored_mapping::page_size(), sizeof(value_type));
+    const auto bytes = std::max(min_capacity, size_type{1}) * sizeof(value_type);
+    return (bytes + granule - 1) / granule * granule;
+  }
+
+  [[nodiscard]] auto data() const noexcept -> value_type* {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return reinterpret_cast<value_type*>(mapping_.data());
+  }
+
+  // -- Data members
+
+  detail::mirrored_mapping mapping_ = {};
+  size_type capacity_ = 0;
+  size_type head_ = 0;
+  size_type size_ = 0;
+};
+
+}  // namespace dlgr
@@ -0,0 +1,249 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <dlgr/cache_line.h>
+
+namespace dlgr {
+
+// == mpmc_ring implementation
+
+// Bounded lock-free queue for any number of producer and consumer threads (D. Vyukov's design).
+//
+// Every slot carries a sequence number which tells whose turn it is: a producer may fill the slot
+// for ticket pos when the sequence equals pos, a consumer may empty it when the sequence equals
+// pos + 1. Threads only compete with a CAS on their side's ticket index, and the element itself is
+// handed over by the release store of the sequence. Blocking push() and pop() spin for a while and
+// then park on the sequence of the slot they wait for with std::atomic::wait.
+//
+// A thread which claimed a ticket must publish it, or the threads of the next laps wait forever, so
+// nothing may throw between the two: elements are moved in and out without throwing, and are built
+// before the ticket is claimed unless that cannot throw either.
+template <class ValueType, class Allocator = std::allocator<ValueType>>
+class mpmc_ring {
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  static_assert(std::is_same_v<typename alloc_traits::value_type, ValueType>);
+  static_assert(std::is_nothrow_move_constructible_v<ValueType>);
+
+ public:
+  // -- Member types
+
+  using value_type = ValueType;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+
+  // -- Constructors
+
+  // Capacity is rounded up to a power of two, and at least two slots are needed to tell a slot
+  // filled in this lap from one emptied in the previous lap
+  [[nodiscard]] explicit mpmc_ring(size_type min_capacity,
+                                   const allocator_type& alloc = allocator_type())
+      : alloc_(alloc),
+        capacity_(std::bit_ceil(std::max(min_capacity, size_type{2}))),
+        mask_(capacity_ - 1),
+        cells_(allocate_cells()) {
+    for (size_type index = 0; index < capacity_; ++index) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::construct_at(std::to_address(cells_) + index, index);
+    }
+  }
+
+  mpmc_ring(const mpmc_ring&) = delete;
+  mpmc_ring(mpmc_ring&&) = delete;
+
+  // -- Destructor
+
+  ~mpmc_ring() noexcept {
+    while (try_pop()) {
+    }
+    std::destroy_n(std::to_address(cells_), capacity_);
+    auto cell_alloc = cell_alloc_type(alloc_);
+    cell_alloc_traits::deallocate(cell_alloc, cells_, capacity_);
+  }
+
+  // -- Assignment
+
+  auto operator=(const mpmc_ring&) -> mpmc_ring& = delete;
+  auto operator=(mpmc_ring&&) -> mpmc_ring& = delete;
+
+  // -- Capacity
+
+  [[nodiscard]] constexpr auto capacity() const noexcept -> size_type { return capacity_; }
+
+  // -- Producer side
+
+  // Arguments of a throwing constructor are consumed even if the queue is full
+  template <class... ArgTypes>
+    requires std::constructible_from<value_type, ArgTypes...>
+  auto try_emplace(ArgTypes&&... args) -> bool {
+    if constexpr (!std::is_nothrow_constructible_v<value_type, ArgTypes...>) {
+      return try_emplace(value_type(std::forward<ArgTypes>(args)...));
+    }
+
+    auto pos = enqueue_pos_.value.load(std::memory_order::relaxed);
+    while (true) {
+      auto& cur_cell = cell_at(pos);
+      const auto seq = cur_cell.sequence.load(std::memory_order::acquire);
+      const auto lag = static_cast<std::ptrdiff_t>(seq - pos);
+
+      if (lag == 0) {
+        if (enqueue_pos_.value.compare_exchange_weak(pos, pos + 1, std::memory_order::relaxed)) {
+          alloc_traits::construct(alloc_, cur_cell.value(), std::forward<ArgTypes>(args)...);
+          publish(cur_cell, pos + 1);
+          return true;
+        }
+      } else if (lag < 0) {
+        // The slot still holds the element from the previous lap
+        return false;
+      } else {
+        pos = enqueue_pos_.value.load(std::memory_order::relaxed);
+      }
+    }
+  }
+
+  auto try_push(const value_type& value) -> bool { return try_emplace(value); }
+
+  auto try_push(value_type&& value) -> bool { return try_emplace(std::move(value)); }
+
+  template <class... ArgTypes>
+    requires std::constructible_from<value_type, ArgTypes...>
+  auto emplace(ArgTypes&&... args) -> void {
+    if constexpr (!std::is_nothrow_constructible_v<value_type, ArgTypes...>) {
+      return emplace(value_type(std::forward<ArgTypes>(args)...));
+    }
+
+    while (true) {
+      for (auto spin = 0; spin < spin_count_; ++spin) {
+        // NOLINTNEXTLINE(bugprone-use-after-move): Arguments are consumed only on success
+        if (try_emplace(std::forward<ArgTypes>(args)...)) {
+          return;
+        }
+      }
+
+      const auto pos = enqueue_pos_.value.load(std::memory_order::relaxed);
+      auto& cur_cell = cell_at(pos);
+      const auto seq = cur_cell.sequence.load(std::memory_order::acquire);
+      if (static_cast<std::ptrdiff_t>(seq - pos) < 0) {
+        cur_cell.sequence.wait(seq, std::memory_order::acquire);
+      }
+    }
+  }
+
+  auto push(const value_type& value) -> void { emplace(value); }
+
+  auto push(value_type&& value) -> void { emplace(std::move(value)); }
+
+  // -- Consumer side
+
+  auto try_pop() -> std::optional<value_type> {
+    auto pos = dequeue_pos_.value.load(std::memory_order::relaxed);
+    while (true) {
+      auto& cur_cell = cell_at(pos);
+      const auto seq = cur_cell.sequence.load(std::memory_order::acquire);
+      const auto lag = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+
+      if (lag == 0) {
+        if (dequeue_pos_.value.compare_exchange_weak(pos, pos + 1, std::memory_order::relaxed)) {
+          auto* src = cur_cell.value();
+          auto value = std::optional<value_type>(std::move(*src));
+          alloc_traits::destroy(alloc_, src);
+          publish(cur_cell, pos + capacity_);
+          return value;
+        }
+      } else if (lag < 0) {
+        // The slot has not been filled in this lap yet
+        return std::nullopt;
+      } else {
+        pos = dequeue_pos_.value.load(std::memory_order::relaxed);
+      }
+    }
+  }
+
+  auto pop() -> value_type {
+    while (true) {
+      for (auto spin = 0; spin < spin_count_; ++spin) {
+        if (auto value = try_pop()) {
+          return std::move(*value);
+        }
+      }
+
+      const auto pos = dequeue_pos_.value.load(std::memory_order::relaxed);
+      auto& cur_cell = cell_at(pos);
+      const auto seq = cur_cell.sequence.load(std::memory_order::acquire);
+      if (static_cast<std::ptrdiff_t>(seq - (pos + 1)) < 0) {
+        cur_cell.sequence.wait(seq, std::memory_order::acquire);
+      }
+    }
+  }
+
+ private:
+  // -- Member types
+
+  struct cell {
+    [[nodiscard]] explicit cell(size_type init_sequence) noexcept : sequence(init_sequence) {}
+
+    [[nodiscard]] auto value() noexcept -> value_type* {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      return std::launder(reinterpret_cast<value_type*>(storage.data()));
+    }
+
+    std::atomic<size_type> sequence;
+    alignas(value_type) std::array<std::byte, sizeof(value_type)> storage = {};
+  };
+
+  struct alignas(cache_line_size) padded_index {
+    std::atomic<size_type> value = 0;
+  };
+
+  using cell_alloc_type = typename alloc_traits::template rebind_alloc<cell>;
+  using cell_alloc_traits = std::allocator_traits<cell_alloc_type>;
+
+  // -- Constants
+
+  constexpr static int spin_count_ = 64;
+
+  // -- Helper functions
+
+  [[nodiscard]] auto allocate_cells() -> typename cell_alloc_traits::pointer {
+    auto cell_alloc = cell_alloc_type(alloc_);
+    return cell_alloc_traits::allocate(cell_alloc, capacity_);
+  }
+
+  [[nodiscard]] auto cell_at(size_type pos) const noexcept -> cell& {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return std::to_address(cells_)[pos & mask_];
+  }
+
+  // Producers and consumers of different laps may park on the same cell, each waiting for its own
+  // sequence value, so all of them are woken to recheck
+  static auto publish(cell& cur_cell, size_type sequence) noexcept -> void {
+    cur_cell.sequence.store(sequence, std::memory_order::release);
+    cur_cell.sequence.notify_all();
+  }
+
+  // -- Data members
+
+  [[no_unique_address]] allocator_type alloc_ = {};
+  size_type capacity_ = 0;
+  size_type mask_ = 0;
+  typename cell_alloc_traits::pointer cells_ = nullptr;
+
+  // Every producer CASes enqueue_pos_ and every consumer dequeue_pos_, so each gets its own line
+  padded_index enqueue_pos_ = {};
+  padded_index dequeue_pos_ = {};
+};
+
+}  // namespace dlgr
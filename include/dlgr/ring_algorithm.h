@@ -0,0 +1,350 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include <gsl/assert>
+
+#include <dlgr/ring_view.h>
+
+namespace dlgr {
+
+namespace ranges {
+
+// Algorithms below walk ring ranges segment by segment, so the inner loops run over the base
+// iterators without the per-element wrap check of the ring iterator.
+
+// == Implementation details
+
+namespace detail {
+
+template <class IterType, class OutIterType>
+concept memcpyable_iterators =
+    std::contiguous_iterator<IterType> && std::contiguous_iterator<OutIterType>
+    && std::same_as<std::iter_value_t<IterType>, std::iter_value_t<OutIterType>>
+    && std::is_trivially_copyable_v<std::iter_value_t<IterType>>;
+
+// Not every standard library lowers ranges::copy of contiguous trivially copyable segments to
+// memmove, so do it explicitly.
+template <class IterType, class OutIterType>
+constexpr auto copy_segment(IterType first, IterType last, OutIterType out) -> OutIterType {
+  if constexpr (memcpyable_iterators<IterType, OutIterType>) {
+    if (!std::is_constant_evaluated()) {
+      const auto count = last - first;
+      if (count > 0) {
+        std::memmove(std::to_address(out), std::to_address(first),
+                     static_cast<std::size_t>(count) * sizeof(std::iter_value_t<IterType>));
+      }
+      return out + count;
+    }
+  }
+  return std::ranges::copy(std::move(first), std::move(last), std::move(out)).out;
+}
+
+// A ring range as a head, some count of whole laps and a tail. Either end may be empty, and the
+// lap is set only if count is not zero.
+template <class SegmentType, class CountType>
+struct ring_laps {
+  SegmentType head = {};
+  SegmentType lap = {};
+  CountType count = 0;
+  SegmentType tail = {};
+};
+
+// Every segment except the first and the last one is the whole base
+template <ring_segmented_iterator IterType>
+constexpr auto split_laps(const IterType& first, const IterType& last) {
+  auto segments = ring_segments(first, last);
+  using segment_type = std::ranges::range_value_t<decltype(segments)>;
+  using count_type = std::iter_difference_t<IterType>;
+
+  auto res = ring_laps<segment_type, count_type>();
+  const auto n_segments = static_cast<count_type>(std::ranges::distance(segments));
+  auto seg_it = std::ranges::begin(segments);
+  if (n_segments > 0) {
+    res.head = *seg_it;
+  }
+  if (n_segments > 2) {
+    res.lap = *std::ranges::next(seg_it);
+    res.count = n_segments - 2;
+  }
+  if (n_segments > 1) {
+    res.tail = *std::ranges::next(seg_it, n_segments - 1);
+  }
+  return res;
+}
+
+template <class OpType, class ValueType>
+inline constexpr bool is_plus_v =
+    std::same_as<OpType, std::plus<>> || std::same_as<OpType, std::plus<ValueType>>;
+
+// op(value, op(value, ...)) with count values. Sums of arithmetic values are a multiplication,
+// anything else takes O(log count) ops by doubling, which needs op to be associative only.
+template <class ValueType, class OpType, std::integral CountType>
+constexpr auto repeat_op(ValueType value, CountType count, OpType& op) -> ValueType {
+  GSL_ASSUME(count > 0);
+
+  if constexpr (std::is_arithmetic_v<ValueType> && is_plus_v<OpType, ValueType>) {
+    return static_cast<ValueType>(value * static_cast<ValueType>(count));
+  } else {
+    auto res = std::optional<ValueType>();
+    while (true) {
+      if ((count & 1) != 0) {
+        res = res ? std::invoke(op, std::move(*res), value) : value;
+      }
+      count >>= 1;
+      if (count == 0) {
+        return std::move(*res);
+      }
+      value = std::invoke(op, value, value);
+    }
+  }
+}
+
+template <class SegmentType, class ValueType, class OpType>
+constexpr auto fold_segment(const SegmentType& segment, ValueType init, OpType& op) -> ValueType {
+  for (auto&& elem : segment) {
+    init = std::invoke(op, std::move(init), std::forward<decltype(elem)>(elem));
+  }
+  return init;
+}
+
+}  // namespace detail
+
+// == copy
+
+template <ring_segmented_iterator IterType, std::weakly_incrementable OutIterType>
+  requires std::indirectly_copyable<IterType, OutIterType>
+constexpr auto copy(IterType first, IterType last, OutIterType out)
+    -> std::ranges::copy_result<IterType, OutIterType> {
+  for (auto&& segment : ring_segments(first, last)) {
+    out = detail::copy_segment(std::ranges::begin(segment), std::ranges::end(segment),
+                               std::move(out));
+  }
+  return {std::move(last), std::move(out)};
+}
+
+template <ring_segmented_range RangeType, std::weakly_incrementable OutIterType>
+  requires std::indirectly_copyable<std::ranges::iterator_t<RangeType>, OutIterType>
+constexpr auto copy(RangeType&& range, OutIterType out)
+    -> std::ranges::copy_result<std::ranges::borrowed_iterator_t<RangeType>, OutIterType> {
+  auto result = dlgr::ranges::copy(std::ranges::begin(range), std::ranges::end(range),
+                                   std::move(out));
+  return {std::move(result.in), std::move(result.out)};
+}
+
+// == fill
+
+template <class ValueType, ring_segmented_iterator IterType>
+  requires std::output_iterator<IterType, const ValueType&>
+constexpr auto fill(IterType first, IterType last, const ValueType& value) -> IterType {
+  for (auto&& segment : ring_segments(first, last)) {
+    std::ranges::fill(segment, value);
+  }
+  return last;
+}
+
+template <class ValueType, ring_segmented_range RangeType>
+  requires std::ranges::output_range<RangeType, const ValueType&>
+constexpr auto fill(RangeType&& range, const ValueType& value)
+    -> std::ranges::borrowed_iterator_t<RangeType> {
+  return dlgr::ranges::fill(std::ranges::begin(range), std::ranges::end(range), value);
+}
+
+// == for_each
+
+template <ring_segmented_iterator IterType, class ProjType = std::identity,
+          std::indirectly_unary_invocable<std::projected<IterType, ProjType>> FunType>
+constexpr auto for_each(IterType first, IterType last, FunType fun, ProjType proj = {})
+    -> std::ranges::for_each_result<IterType, FunType> {
+  for (auto&& segment : ring_segments(first, last)) {
+    std::ranges::for_each(segment, std::ref(fun), std::ref(proj));
+  }
+  return {std::move(last), std::move(fun)};
+}
+
+template <ring_segmented_range RangeType, class ProjType = std::identity,
+          std::indirectly_unary_invocable<
+              std::projected<std::ranges::iterator_t<RangeType>, ProjType>> FunType>
+constexpr auto for_each(RangeType&& range, FunType fun, ProjType proj = {})
+    -> std::ranges::for_each_result<std::ranges::borrowed_iterator_t<RangeType>, FunType> {
+  auto result = dlgr::ranges::for_each(std::ranges::begin(range), std::ranges::end(range),
+                                       std::move(fun), std::move(proj));
+  return {std::move(result.in), std::move(result.fun)};
+}
+
+// == transform
+
+template <ring_segmented_iterator IterType, std::weakly_incrementable OutIterType,
+          std::copy_constructible FunType, class ProjType = std::identity>
+  requires std::indirectly_writable<
+      OutIterType, std::indirect_result_t<FunType&, std::projected<IterType, ProjType>>>
+constexpr auto transform(IterType first, IterType last, OutIterType out, FunType fun,
+                         ProjType proj = {})
+    -> std::ranges::unary_transform_result<IterType, OutIterType> {
+  for (auto&& segment : ring_segments(first, last)) {
+    out = std::ranges::transform(segment, std::move(out), std::ref(fun), std::ref(proj)).out;
+  }
+  return {std::move(last), std::move(out)};
+}
+
+template <ring_segmented_range RangeType, std::weakly_incrementable OutIterType,
+          std::copy_constructible FunType, class ProjType = std::identity>
+  requires std::indirectly_writable<
+      OutIterType,
+      std::indirect_result_t<FunType&, std::projected<std::ranges::iterator_t<RangeType>, ProjType>>>
+constexpr auto transform(RangeType&& range, OutIterType out, FunType fun, ProjType proj = {})
+    -> std::ranges::unary_transform_result<std::ranges::borrowed_iterator_t<RangeType>,
+                                           OutIterType> {
+  auto result = dlgr::ranges::transform(std::ranges::begin(range), std::ranges::end(range),
+                                        std::move(out), std::move(fun), std::move(proj));
+  return {std::move(result.in), std::move(result.out)};
+}
+
+// == ring_reduce
+
+// Folds the base once per distinct lap shape, instead of once per lap. Op must be associative,
+// but not commutative: laps are combined in order. For floating point sums the result may
+// differ from a left fold by rounding.
+template <ring_segmented_iterator IterType, std::movable ValueType, class OpType = std::plus<>>
+  requires std::is_invocable_r_v<ValueType, OpType&, ValueType, std::iter_reference_t<IterType>>
+           && std::is_invocable_r_v<ValueType, OpType&, ValueType, ValueType>
+           && std::constructible_from<ValueType, std::iter_reference_t<IterType>>
+           && std::copyable<ValueType>
+constexpr auto ring_reduce(IterType first, IterType last, ValueType init, OpType op = {})
+    -> ValueType {
+  auto laps = detail::split_laps(first, last);
+
+  init = detail::fold_segment(laps.head, std::move(init), op);
+  if (laps.count > 0) {
+    auto lap_first = std::ranges::begin(laps.lap);
+    auto lap_value = detail::fold_segment(
+        std::ranges::subrange(std::ranges::next(lap_first), std::ranges::end(laps.lap)),
+        ValueType(*lap_first), op);
+    init = std::invoke(op, std::move(init), detail::repeat_op(std::move(lap_value), laps.count, op));
+  }
+  return detail::fold_segment(laps.tail, std::move(init), op);
+}
+
+template <ring_segmented_range RangeType, std::movable ValueType, class OpType = std::plus<>>
+  requires std::is_invocable_r_v<ValueType, OpType&, ValueType,
+                                 std::ranges::range_reference_t<RangeType>>
+           && std::is_invocable_r_v<ValueType, OpType&, ValueType, ValueType>
+           && std::constructible_from<ValueType, std::ranges::range_reference_t<RangeType>>
+           && std::copyable<ValueType>
+constexpr auto ring_reduce(RangeType&& range, ValueType init, OpType op = {}) -> ValueType {
+  return dlgr::ranges::ring_reduce(std::ranges::begin(range), std::ranges::end(range),
+                                   std::move(init), std::move(op));
+}
+
+// == ring_count
+
+template <ring_segmented_iterator IterType, class ProjType = std::identity,
+          std::indirect_unary_predicate<std::projected<IterType, ProjType>> PredType>
+constexpr auto ring_count_if(IterType first, IterType last, PredType pred, ProjType proj = {})
+    -> std::iter_difference_t<IterType> {
+  auto laps = detail::split_laps(first, last);
+
+  auto res = std::ranges::count_if(laps.head, std::ref(pred), std::ref(proj))
+             + std::ranges::count_if(laps.tail, std::ref(pred), std::ref(proj));
+  if (laps.count > 0) {
+    res += laps.count * std::ranges::count_if(laps.lap, std::ref(pred), std::ref(proj));
+  }
+  return static_cast<std::iter_difference_t<IterType>>(res);
+}
+
+template <ring_segmented_range RangeType, class ProjType = std::identity,
+          std::indirect_unary_predicate<
+              std::projected<std::ranges::iterator_t<RangeType>, ProjType>> PredType>
+constexpr auto ring_count_if(RangeType&& range, PredType pred, ProjType proj = {})
+    -> std::ranges::range_difference_t<RangeType> {
+  return dlgr::ranges::ring_count_if(std::ranges::begin(range), std::ranges::end(range),
+                                     std::move(pred), std::move(proj));
+}
+
+template <ring_segmented_iterator IterType, class ValueType, class ProjType = std::identity>
+  requires std::indirect_binary_predicate<std::ranges::equal_to,
+                                          std::projected<IterType, ProjType>, const ValueType*>
+constexpr auto ring_count(IterType first, IterType last, const ValueType& value,
+                          ProjType proj = {}) -> std::iter_difference_t<IterType> {
+  return dlgr::ranges::ring_count_if(
+      std::move(first), std::move(last),
+      [&value](const auto& elem) { return elem == value; }, std::move(proj));
+}
+
+template <ring_segmented_range RangeType, class ValueType, class ProjType = std::identity>
+  requires std::indirect_binary_predicate<
+      std::ranges::equal_to, std::projected<std::ranges::iterator_t<RangeType>, ProjType>,
+      const ValueType*>
+constexpr auto ring_count(RangeType&& range, const ValueType& value, ProjType proj = {})
+    -> std::ranges::range_difference_t<RangeType> {
+  return dlgr::ranges::ring_count(std::ranges::begin(range), std::ranges::end(range), value,
+                                  std::move(proj));
+}
+
+// == ring_minmax
+
+// The head, one whole lap and the tail hold every element the range does, so at most three base
+// passes are needed for any number of laps
+template <ring_segmented_iterator IterType, class ProjType = std::identity,
+          std::indirect_strict_weak_order<std::projected<IterType, ProjType>> CompType =
+              std::ranges::less>
+  requires std::indirectly_copyable_storable<IterType, std::iter_value_t<IterType>*>
+constexpr auto ring_minmax(IterType first, IterType last, CompType comp = {}, ProjType proj = {})
+    -> std::ranges::minmax_result<std::iter_value_t<IterType>> {
+  using result_type = std::ranges::minmax_result<std::iter_value_t<IterType>>;
+
+  Expects(first != last);
+
+  auto laps = detail::split_laps(first, last);
+  auto less = [&](const auto& lhs, const auto& rhs) {
+    return std::invoke(comp, std::invoke(proj, lhs), std::invoke(proj, rhs));
+  };
+
+  // Same ties as std::ranges::minmax: the first smallest and the last largest element
+  auto res = std::optional<result_type>();
+  for (const auto* segment : {&laps.head, &laps.lap, &laps.tail}) {
+    if (std::ranges::empty(*segment)) {
+      continue;
+    }
+    auto cur = std::ranges::minmax(*segment, std::ref(comp), std::ref(proj));
+    if (!res) {
+      res.emplace(std::move(cur));
+      continue;
+    }
+    if (less(cur.min, res->min)) {
+      res->min = std::move(cur.min);
+    }
+    if (!less(cur.max, res->max)) {
+      res->max = std::move(cur.max);
+    }
+  }
+  return std::move(*res);
+}
+
+template <ring_segmented_range RangeType, class ProjType = std::identity,
+          std::indirect_strict_weak_order<
+              std::projected<std::ranges::iterator_t<RangeType>, ProjType>> CompType =
+              std::ranges::less>
+  requires std::indirectly_copyable_storable<std::ranges::iterator_t<RangeType>,
+                                             std::ranges::range_value_t<RangeType>*>
+constexpr auto ring_minmax(RangeType&& range, CompType comp = {}, ProjType proj = {})
+    -> std::ranges::minmax_result<std::ranges::range_value_t<RangeType>> {
+  return dlgr::ranges::ring_minmax(std::ranges::begin(range), std::ranges::end(range),
+                                   std::move(comp), std::move(proj));
+}
+
+}  // namespace ranges
+
+}  // namespace dlgr
@@ -0,0 +1,265 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <new>
+
+#include <gsl/assert>
+
+namespace dlgr {
+
+// == ring_arena implementation
+
+// Allocator for memory which is freed roughly in the order it was allocated, e.g. messages
+// passing through a pipeline. Blocks are cut one after another from a circular buffer, so an
+// allocation is a bump of the head offset, and a block which does not fit before the end of the
+// buffer starts over at its beginning behind a skip block.
+//
+// Every block starts with a header holding its size, which chains the blocks from the tail to the
+// head. Freeing the oldest block moves the tail past it and past every later block freed already,
+// freeing any other block only marks it, and the tail reclaims it once it gets there. The arena
+// is not thread-safe, and a block which is never freed stops the tail for good.
+class ring_arena {
+ public:
+  // -- Member types
+
+  using size_type = std::size_t;
+
+  // -- Constants
+
+  // Alignment of every block, and of the payloads unless more is asked for
+  constexpr static auto block_alignment = size_type{alignof(std::max_align_t)};
+
+  // -- Constructors
+
+  // Capacity is rounded up to a multiple of block_alignment and taken from upstream at once
+  [[nodiscard]] explicit ring_arena(
+      size_type capacity, std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+      : upstream_(upstream), capacity_(align_up(capacity, block_alignment)) {
+    Expects(capacity_ > 0 && capacity_ <= max_capacity);
+    data_ = static_cast<std::byte*>(upstream_->allocate(capacity_, block_alignment));
+  }
+
+  ring_arena(const ring_arena&) = delete;
+  ring_arena(ring_arena&&) = delete;
+
+  // -- Destructor
+
+  // Blocks still in use become invalid
+  ~ring_arena() noexcept { upstream_->deallocate(data_, capacity_, block_alignment); }
+
+  // -- Assignment
+
+  auto operator=(const ring_arena&) -> ring_arena& = delete;
+  auto operator=(ring_arena&&) -> ring_arena& = delete;
+
+  // -- Capacity
+
+  [[nodiscard]] auto capacity() const noexcept -> size_type { return capacity_; }
+
+  // Bytes between the tail and the head, headers, padding and unreclaimed blocks included
+  [[nodiscard]] auto used() const noexcept -> size_type { return used_; }
+
+  [[nodiscard]] auto empty() const noexcept -> bool { return used_ == 0; }
+
+  // -- Allocation
+
+  // Returns nullptr if there is no room between the head and the tail
+  [[nodiscard]] auto try_allocate(size_type bytes, size_type alignment = block_alignment) noexcept
+      -> void* {
+    Expects(std::has_single_bit(alignment));
+
+    if (used_ == 0) {
+      return place(0, capacity_, bytes, alignment);
+    }
+    if (head_ == tail_) {
+      return nullptr;
+    }
+    if (head_ < tail_) {
+      return place(head_, tail_, bytes, alignment);
+    }
+
+    // Free space is the end of the buffer and then its beginning up to the tail
+    if (auto* payload = place(head_, capacity_, bytes, alignment)) {
+      return payload;
+    }
+    if (!fits(0, tail_, bytes, alignment)) {
+      return nullptr;
+    }
+    const auto skipped = capacity_ - head_;
+    write_header(head_, skipped);
+    used_ += skipped;
+    return place(0, tail_, bytes, alignment);
+  }
+
+  // Same as try_allocate(), but throws std::bad_alloc
+  [[nodiscard]] auto allocate(size_type bytes, size_type alignment = block_alignment) -> void* {
+    auto* payload = try_allocate(bytes, alignment);
+    if (payload == nullptr) {
+      throw std::bad_alloc();
+    }
+    return payload;
+  }
+
+  // Takes any pointer returned by allocate() or try_allocate() and not freed yet
+  auto deallocate(void* payload) noexcept -> void {
+    auto distance = std::uint32_t{0};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::memcpy(&distance, static_cast<std::byte*>(payload) - sizeof(distance), sizeof(distance));
+    const auto offset =
+        static_cast<size_type>(static_cast<std::byte*>(payload) - data_) - size_type{distance};
+    Expects(offset < capacity_ && header_at(offset).live != 0);
+
+    header_at(offset).live = 0;
+    if (offset == tail_) {
+      reclaim();
+    }
+  }
+
+ private:
+  // -- Member types
+
+  // The payload offset is the last field, so it is right before the payload whenever the payload
+  // follows the header directly, and otherwise a copy of it is put there
+  struct alignas(block_alignment) header {
+    std::uint64_t size = 0;
+    std::uint32_t live = 0;
+    std::uint32_t payload_offset = 0;
+  };
+
+  static_assert(sizeof(header) == block_alignment);
+
+  // -- Constants
+
+  // Payload offsets must fit into 32 bits
+  constexpr static auto max_capacity = size_type{1} << 31U;
+
+  // -- Helper functions
+
+  [[nodiscard]] constexpr static auto align_up(size_type value, size_type alignment) noexcept
+      -> size_type {
+    return (value + alignment - 1) & ~(alignment - 1);
+  }
+
+  [[nodiscard]] auto payload_offset(size_type offset, size_type alignment) const noexcept
+      -> size_type {
+    const auto address = reinterpret_cast<std::uintptr_t>(data_) + offset;  // NOLINT
+    return align_up(address + sizeof(header), alignment) - address;
+  }
+
+  [[nodiscard]] auto block_size(size_type offset, size_type bytes,
+                                size_type alignment) const noexcept -> size_type {
+    return align_up(payload_offset(offset, alignment) + bytes, block_alignment);
+  }
+
+  [[nodiscard]] auto fits(size_type offset, size_type limit, size_type bytes,
+                          size_type alignment) const noexcept -> bool {
+    return bytes <= limit - offset && block_size(offset, bytes, alignment) <= limit - offset;
+  }
+
+  // Cuts a block at offset if it ends by limit, returns its payload or nullptr
+  [[nodiscard]] auto place(size_type offset, size_type limit, size_type bytes,
+                           size_type alignment) noexcept -> void* {
+    if (!fits(offset, limit, bytes, alignment)) {
+      return nullptr;
+    }
+
+    const auto size = block_size(offset, bytes, alignment);
+    const auto distance = static_cast<std::uint32_t>(payload_offset(offset, alignment));
+    auto& block = write_header(offset, size);
+    block.live = 1;
+    block.payload_offset = distance;
+
+    auto* payload = data_ + offset + distance;  // NOLINT(*-pointer-arithmetic)
+    std::memcpy(payload - sizeof(distance), &distance, sizeof(distance));  // NOLINT
+
+    used_ += size;
+    head_ = offset + size == capacity_ ? 0 : offset + size;
+    return payload;
+  }
+
+  // Not live until marked so, which makes skip blocks free from the start
+  auto write_header(size_type offset, size_type size) noexcept -> header& {
+    return *::new (data_ + offset) header{size, 0, 0};  // NOLINT(*-pointer-arithmetic)
+  }
+
+  [[nodiscard]] auto header_at(size_type offset) noexcept -> header& {
+    return *std::launder(reinterpret_cast<header*>(data_ + offset));  // NOLINT
+  }
+
+  // Moves the tail past every freed block in a row
+  auto reclaim() noexcept -> void {
+    while (used_ != 0 && header_at(tail_).live == 0) {
+      const auto size = static_cast<size_type>(header_at(tail_).size);
+      used_ -= size;
+      tail_ = tail_ + size == capacity_ ? 0 : tail_ + size;
+    }
+
+    // Starting over from the beginning keeps the next blocks in one run
+    if (used_ == 0) {
+      head_ = 0;
+      tail_ = 0;
+    }
+  }
+
+  // -- Data members
+
+  std::pmr::memory_resource* upstream_ = nullptr;
+  std::byte* data_ = nullptr;
+  size_type capacity_ = 0;
+  size_type head_ = 0;
+  size_type tail_ = 0;
+  size_type used_ = 0;
+};
+
+// == ring_arena_resource implementation
+
+// Polymorphic memory resource over a ring_arena, which must outlive it. Sizes and alignments
+// passed to deallocate are not needed and are ignored.
+class ring_arena_resource final : public std::pmr::memory_resource {
+ public:
+  // -- Constructors
+
+  [[nodiscard]] explicit ring_arena_resource(ring_arena& arena) noexcept : arena_(&arena) {}
+
+  ring_arena_resource(const ring_arena_resource&) = delete;
+  ring_arena_resource(ring_arena_resource&&) = delete;
+
+  // -- Destructor
+
+  ~ring_arena_resource() noexcept override = default;
+
+  // -- Assignment
+
+  auto operator=(const ring_arena_resource&) -> ring_arena_resource& = delete;
+  auto operator=(ring_arena_resource&&) -> ring_arena_resource& = delete;
+
+  // -- Observers
+
+  [[nodiscard]] auto arena() const noexcept -> ring_arena& { return *arena_; }
+
+ private:
+  auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override {
+    return arena_->allocate(bytes, alignment);
+  }
+
+  auto do_deallocate(void* payload, [[maybe_unused]] std::size_t bytes,
+                     [[maybe_unused]] std::size_t alignment) -> void override {
+    arena_->deallocate(payload);
+  }
+
+  [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other) const noexcept
+      -> bool override {
+    const auto* resource = dynamic_cast<const ring_arena_resource*>(&other);
+    return resource != nullptr && resource->arena_ == arena_;
+  }
+
+  ring_arena* arena_ = nullptr;
+};
+
+}  // namespace dlgr
@@ -0,0 +1,493 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <gsl/assert>
+
+#include <dlgr/ring_view.h>
+
+namespace dlgr {
+
+// == Overflow policies
+
+struct ring_buffer_reject_t {
+  // NOLINTNEXTLINE(runtime/explicit): Explicit default ctor for tag type
+  constexpr explicit ring_buffer_reject_t() noexcept = default;
+};
+
+inline constexpr ring_buffer_reject_t ring_buffer_reject{};
+
+struct ring_buffer_overwrite_t {
+  // NOLINTNEXTLINE(runtime/explicit): Explicit default ctor for tag type
+  constexpr explicit ring_buffer_overwrite_t() noexcept = default;
+};
+
+inline constexpr ring_buffer_overwrite_t ring_buffer_overwrite{};
+
+template <class T>
+concept ring_buffer_overflow_policy = is_any_of<T, ring_buffer_reject_t, ring_buffer_overwrite_t>;
+
+// == Capacity specification
+
+struct ring_buffer_pow2_capacity_t {
+  // NOLINTNEXTLINE(runtime/explicit): Explicit default ctor for tag type
+  constexpr explicit ring_buffer_pow2_capacity_t() noexcept = default;
+};
+
+inline constexpr ring_buffer_pow2_capacity_t ring_buffer_pow2_capacity{};
+
+// == ring_buffer implementation
+
+// Fixed-capacity FIFO over a single allocation. Elements are constructed in place, iterators are
+// ring_view iterators over the storage, so wrap semantics and segmented algorithms are shared.
+template <class ValueType, class Allocator = std::allocator<ValueType>,
+          ring_buffer_overflow_policy OverflowPolicy = ring_buffer_reject_t>
+class ring_buffer {
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  constexpr static bool is_overwrite_ = std::is_same_v<OverflowPolicy, ring_buffer_overwrite_t>;
+
+  using storage_view_type = ranges::ring_view<std::span<ValueType>, ranges::ring_view_bound_t>;
+  using const_storage_view_type =
+      ranges::ring_view<std::span<const ValueType>, ranges::ring_view_bound_t>;
+
+  static_assert(std::is_same_v<typename alloc_traits::value_type, ValueType>);
+
+ public:
+  // -- Member types
+
+  using value_type = ValueType;
+  using allocator_type = Allocator;
+  using overflow_policy = OverflowPolicy;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = typename alloc_traits::pointer;
+  using const_pointer = typename alloc_traits::const_pointer;
+  using iterator = typename storage_view_type::iterator_type;
+  using const_iterator = typename const_storage_view_type::iterator_type;
+  using span_type = std::span<value_type>;
+  using const_span_type = std::span<const value_type>;
+
+  // -- Constructors
+
+  [[nodiscard]] constexpr ring_buffer() noexcept(noexcept(allocator_type()))
+    requires std::default_initializable<allocator_type>
+  = default;
+
+  [[nodiscard]] constexpr explicit ring_buffer(size_type capacity,
+                                               const allocator_type& alloc = allocator_type())
+      : alloc_(alloc) {
+    allocate(capacity);
+  }
+
+  [[nodiscard]] constexpr ring_buffer([[maybe_unused]] ring_buffer_pow2_capacity_t pow2_capacity,
+                                      size_type min_capacity,
+                                      const allocator_type& alloc = allocator_type())
+      : ring_buffer(std::bit_ceil(min_capacity), alloc) {}
+
+  [[nodiscard]] constexpr ring_buffer(const ring_buffer& other)
+      : ring_buffer(other, alloc_traits::select_on_container_copy_construction(other.alloc_)) {}
+
+  [[nodiscard]] constexpr ring_buffer(const ring_buffer& other, const allocator_type& alloc)
+      : alloc_(alloc) {
+    allocate(other.capacity_);
+    push_n(other.begin(), other.size_);
+  }
+
+  [[nodiscard]] constexpr ring_buffer(ring_buffer&& other) noexcept
+      : alloc_(std::move(other.alloc_)),
+        data_(std::exchange(other.data_, nullptr)),
+        capacity_(std::exchange(other.capacity_, 0)),
+        head_(std::exchange(other.head_, 0)),
+        size_(std::exchange(other.size_, 0)),
+        pow2_(std::exchange(other.pow2_, false)),
+        storage_begin_(std::exchange(other.storage_begin_, {})),
+        const_storage_begin_(std::exchange(other.const_storage_begin_, {})) {}
+
+  [[nodiscard]] constexpr ring_buffer(ring_buffer&& other, const allocator_type& alloc)
+      : alloc_(alloc) {
+    if (alloc_ == other.alloc_) {
+      steal(other);
+    } else {
+      allocate(other.capacity_);
+      push_n(std::move_iterator(other.begin()), other.size_);
+      other.clear();
+    }
+  }
+
+  // -- Destructor
+
+  constexpr ~ring_buffer() noexcept { deallocate(); }
+
+  // -- Assignment
+
+  constexpr auto operator=(const ring_buffer& other) -> ring_buffer& {
+    if (this != &other) {
+      auto copy = ring_buffer(other, alloc_traits::propagate_on_container_copy_assignment::value
+                                         ? other.alloc_
+                                         : alloc_);
+      swap_storage(copy);
+    }
+    return *this;
+  }
+
+  constexpr auto operator=(ring_buffer&& other) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value
+      || alloc_traits::is_always_equal::value) -> ring_buffer& {
+    if (this != &other) {
+      if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+        auto moved = ring_buffer(std::move(other));
+        swap_storage(moved);
+      } else {
+        auto moved = ring_buffer(std::move(other), alloc_);
+        swap_storage(moved);
+      }
+    }
+    return *this;
+  }
+
+  // -- Iterators
+
+  [[nodiscard]] constexpr auto begin() -> iterator {
+    return storage_begin_ + static_cast<difference_type>(head_);
+  }
+
+  [[nodiscard]] constexpr auto begin() const -> const_iterator {
+    return const_storage_begin_ + static_cast<difference_type>(head_);
+  }
+
+  [[nodiscard]] constexpr auto end() -> iterator {
+    return storage_begin_ + static_cast<difference_type>(head_ + size_);
+  }
+
+  [[nodiscard]] constexpr auto end() const -> const_iterator {
+    return const_storage_begin_ + static_cast<difference_type>(head_ + size_);
+  }
+
+  [[nodiscard]] constexpr auto cbegin() const -> const_iterator { return begin(); }
+
+  [[nodiscard]] constexpr auto cend() const -> const_iterator { return end(); }
+
+  // -- Capacity
+
+  [[nodiscard]] constexpr auto size() const noexcept -> size_type { return size_; }
+
+  [[nodiscard]] constexpr auto capacity() const noexcept -> size_type { return capacity_; }
+
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool { return size_ == 0; }
+
+  [[nodiscard]] constexpr auto full() const noexcept -> bool { return size_ == capacity_; }
+
+  [[nodiscard]] constexpr auto get_allocator() const -> allocator_type { return alloc_; }
+
+  // -- Element access
+
+  [[nodiscard]] constexpr auto operator[](size_type index) -> reference {
+    Expects(index < size_);
+    return *slot(index);
+  }
+
+  [[nodiscard]] constexpr auto operator[](size_type index) const -> const_reference {
+    Expects(index < size_);
+    return *slot(index);
+  }
+
+  [[nodiscard]] constexpr auto front() -> reference { return (*this)[0]; }
+
+  [[nodiscard]] constexpr auto front() const -> const_reference { return (*this)[0]; }
+
+  [[nodiscard]] constexpr auto back() -> reference { return (*this)[size_ - 1]; }
+
+  [[nodiscard]] constexpr auto back() const -> const_reference { return (*this)[size_ - 1]; }
+
+  // The two contiguous parts of the stored elements, in FIFO order
+  [[nodiscard]] constexpr auto as_spans() noexcept -> std::array<span_type, 2> {
+    return make_spans<value_type>();
+  }
+
+  [[nodiscard]] constexpr auto as_spans() const noexcept -> std::array<const_span_type, 2> {
+    return make_spans<const value_type>();
+  }
+
+  // -- Modification
+
+  // Returns false if the element was rejected because the buffer is full
+  template <class... ArgTypes>
+    requires std::constructible_from<value_type, ArgTypes...>
+  constexpr auto emplace_back(ArgTypes&&... args) -> bool {
+    if (size_ == capacity_) {
+      if constexpr (is_overwrite_) {
+        if (capacity_ == 0) {
+          return false;
+        }
+        // The arguments may refer to the front element, e.g. push_back(front()), so the value is
+        // built before that element is destroyed and its slot reused
+        auto value = value_type(std::forward<ArgTypes>(args)...);
+        pop_front();
+        alloc_traits::construct(alloc_, slot(size_), std::move(value));
+        ++size_;
+        return true;
+      } else {
+        return false;
+      }
+    }
+
+    alloc_traits::construct(alloc_, slot(size_), std::forward<ArgTypes>(args)...);
+    ++size_;
+    return true;
+  }
+
+  constexpr auto push_back(const value_type& value) -> bool { return emplace_back(value); }
+
+  constexpr auto push_back(value_type&& value) -> bool { return emplace_back(std::move(value)); }
+
+  constexpr auto pop_front() -> void {
+    Expects(!empty());
+    drop_front(1);
+  }
+
+  constexpr auto pop_back() -> void {
+    Expects(!empty());
+    alloc_traits::destroy(alloc_, slot(size_ - 1));
+    --size_;
+  }
+
+  // Pushes up to count elements and returns how many of them were consumed from the input. With
+  // the overwrite policy all of them are consumed and only the last capacity() ones are kept.
+  //
+  // The input may point into this buffer, e.g. push_n(begin(), size()): elements about to be
+  // overwritten are then copied aside first. A single pass input, or one which computes elements
+  // from this buffer on dereference, must not read the elements it overwrites.
+  template <std::input_iterator IterType>
+    requires std::constructible_from<value_type, std::iter_reference_t<IterType>>
+  constexpr auto push_n(IterType first, size_type count) -> size_type {
+    const auto consumed = count;
+
+    if constexpr (is_overwrite_) {
+      if (count > capacity_) {
+        const auto skipped = count - capacity_;
+        std::ranges::advance(first, static_cast<std::iter_difference_t<IterType>>(skipped));
+        count = capacity_;
+      }
+      const auto free = capacity_ - size_;
+      if (count > free) {
+        if constexpr (may_alias<IterType>) {
+          if (aliases(first, count)) {
+            auto copy = std::vector<value_type, allocator_type>(alloc_);
+            copy.reserve(count);
+            for (auto left = count; left != 0; --left, ++first) {
+              copy.emplace_back(*first);
+            }
+            push_n(std::make_move_iterator(copy.begin()), count);
+            return consumed;
+          }
+        }
+        drop_front(count - free);
+      }
+    } else {
+      count = std::min(count, capacity_ - size_);
+      if (count == 0) {
+        return 0;
+      }
+    }
+
+    const auto tail = wrap(head_ + size_);
+    const auto first_run = std::min(count, capacity_ - tail);
+    first = construct_n(tail, std::move(first), first_run);
+    construct_n(0, std::move(first), count - first_run);
+
+    return is_overwrite_ ? consumed : count;
+  }
+
+  // Moves min(count, size()) front elements to out and removes them
+  template <std::weakly_incrementable OutIterType>
+    requires std::indirectly_writable<OutIterType, value_type&&>
+  constexpr auto pop_n(size_type count, OutIterType out) -> OutIterType {
+    count = std::min(count, size_);
+
+    auto left = count;
+    for (auto span : as_spans()) {
+      const auto run = std::min(left, span.size());
+      out = std::ranges::move(span.first(run), std::move(out)).out;
+      left -= run;
+    }
+
+    drop_front(count);
+    return out;
+  }
+
+  constexpr auto clear() noexcept -> void { drop_front(size_); }
+
+  constexpr auto swap(ring_buffer& other) noexcept -> void { swap_storage(other); }
+
+  constexpr friend auto swap(ring_buffer& lhs, ring_buffer& rhs) noexcept -> void {
+    lhs.swap(rhs);
+  }
+
+ private:
+  // -- Helper functions
+
+  constexpr auto allocate(size_type capacity) -> void {
+    if (capacity == 0) {
+      return;
+    }
+    data_ = alloc_traits::allocate(alloc_, capacity);
+    capacity_ = capacity;
+    pow2_ = std::has_single_bit(capacity);
+    make_storage_begins();
+  }
+
+  constexpr auto deallocate() noexcept -> void {
+    clear();
+    if (data_ != nullptr) {
+      alloc_traits::deallocate(alloc_, data_, capacity_);
+      data_ = nullptr;
+    }
+    capacity_ = 0;
+    head_ = 0;
+    pow2_ = false;
+    storage_begin_ = {};
+    const_storage_begin_ = {};
+  }
+
+  constexpr auto steal(ring_buffer& other) noexcept -> void {
+    data_ = std::exchange(other.data_, nullptr);
+    capacity_ = std::exchange(other.capacity_, 0);
+    head_ = std::exchange(other.head_, 0);
+    size_ = std::exchange(other.size_, 0);
+    pow2_ = std::exchange(other.pow2_, false);
+    storage_begin_ = std::exchange(other.storage_begin_, {});
+    const_storage_begin_ = std::exchange(other.const_storage_begin_, {});
+  }
+
+  constexpr auto swap_storage(ring_buffer& other) noexcept -> void {
+    using std::swap;
+    if constexpr (alloc_traits::propagate_on_container_swap::value
+                  || !alloc_traits::is_always_equal::value) {
+      swap(alloc_, other.alloc_);
+    }
+    swap(data_, other.data_);
+    swap(capacity_, other.capacity_);
+    swap(head_, other.head_);
+    swap(size_, other.size_);
+    swap(pow2_, other.pow2_);
+    swap(storage_begin_, other.storage_begin_);
+    swap(const_storage_begin_, other.const_storage_begin_);
+  }
+
+  // Index is at most twice the capacity, so a single subtraction is enough without a mask
+  [[nodiscard]] constexpr auto wrap(size_type index) const noexcept -> size_type {
+    GSL_ASSUME(index < 2 * capacity_ || capacity_ == 0);
+    if (pow2_) {
+      return index & (capacity_ - 1);
+    }
+    return index < capacity_ ? index : index - capacity_;
+  }
+
+  [[nodiscard]] constexpr auto slot(size_type index) const noexcept -> value_type* {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return std::to_address(data_) + wrap(head_ + index);
+  }
+
+  // Built once per allocation: the iterators carry the lap length, which takes a division to
+  // compute unless the capacity is a power of two
+  constexpr auto make_storage_begins() -> void {
+    storage_begin_ = storage_view_type(span_type(std::to_address(data_), capacity_), 2).begin();
+    const_storage_begin_ =
+        const_storage_view_type(const_span_type(std::to_address(data_), capacity_), 2).begin();
+  }
+
+  template <class SpanValueType>
+  [[nodiscard]] constexpr auto make_spans() const noexcept
+      -> std::array<std::span<SpanValueType>, 2> {
+    auto* data = std::to_address(data_);
+    const auto first_size = std::min(size_, capacity_ - head_);
+    return {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::span<SpanValueType>(data + head_, first_size),
+        std::span<SpanValueType>(data, size_ - first_size),
+    };
+  }
+
+  // Inputs whose elements may live in the storage of this buffer
+  template <class IterType>
+  constexpr static bool may_alias =
+      std::forward_iterator<IterType> && std::is_lvalue_reference_v<std::iter_reference_t<IterType>>
+      && std::same_as<std::remove_cvref_t<std::iter_reference_t<IterType>>, value_type>
+      && std::move_constructible<value_type>;
+
+  template <class IterType>
+  [[nodiscard]] constexpr auto aliases(IterType first, size_type count) const noexcept -> bool {
+    const auto* begin = std::to_address(data_);
+    const auto* end = begin + capacity_;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const auto within = [begin, end](const value_type* element) {
+      return std::less_equal<>()(begin, element) && std::less<>()(element, end);
+    };
+
+    if constexpr (std::contiguous_iterator<IterType>) {
+      const auto* input = std::to_address(first);
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      return std::less<>()(input, end) && std::less<>()(begin, input + count);
+    } else {
+      for (; count != 0; --count, ++first) {
+        if (within(std::addressof(*first))) {
+          return true;
+        }
+      }
+      return false;
+    }
+  }
+
+  template <class IterType>
+  constexpr auto construct_n(size_type index, IterType first, size_type count) -> IterType {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto* dest = std::to_address(data_) + index;
+    for (auto* dest_end = dest + count; dest != dest_end; ++dest) {
+      alloc_traits::construct(alloc_, dest, *first);
+      ++first;
+      ++size_;
+    }
+    return first;
+  }
+
+  constexpr auto drop_front(size_type count) noexcept -> void {
+    GSL_ASSUME(count <= size_);
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      for (size_type index = 0; index < count; ++index) {
+        alloc_traits::destroy(alloc_, slot(index));
+      }
+    }
+    head_ = count == 0 ? head_ : wrap(head_ + count);
+    size_ -= count;
+  }
+
+  // -- Data members
+
+  [[no_unique_address]] allocator_type alloc_ = {};
+  pointer data_ = nullptr;
+  size_type capacity_ = 0;
+  size_type head_ = 0;
+  size_type size_ = 0;
+  bool pow2_ = false;
+  // Start of two laps over the storage, so iterators from any head run to the end without
+  // wrapping back
+  iterator storage_begin_ = {};
+  const_iterator const_storage_begin_ = {};
+};
+
+}  // namespace dlgr
@@ -0,0 +1,242 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <dlgr/ring_view.h>
+
+namespace dlgr {
+
+namespace ranges {
+
+// Parallel algorithms below cut a ring range into chunks of about the same number of elements.
+// Segments are laps of the same base, whole ones except the first and the last, so chunk bounds
+// are found by lap arithmetic, and a chunk is split further at lap bounds, so every piece runs
+// over plain base iterators.
+
+// == Options
+
+struct parallel_options {
+  // Zero means std::thread::hardware_concurrency()
+  std::size_t threads = 0;
+  // Smaller ranges get fewer threads, so each one has at least that much work
+  std::size_t min_chunk_size = 16'384;
+};
+
+// == Implementation details
+
+namespace detail {
+
+template <class RangeType>
+concept ring_parallel_range =
+    ring_segmented_range<RangeType>
+    && std::random_access_iterator<ring_segment_iterator_t<RangeType>>;
+
+[[nodiscard]] inline auto parallel_threads_count(std::size_t size, const parallel_options& options)
+    -> std::size_t {
+  const auto hardware = static_cast<std::size_t>(std::thread::hardware_concurrency());
+  const auto threads = options.threads != 0 ? options.threads : std::max(std::size_t{1}, hardware);
+  const auto by_size = size / std::max(std::size_t{1}, options.min_chunk_size);
+  return std::clamp(by_size, std::size_t{1}, threads);
+}
+
+// Calls piece_fun(chunk, first, last, offset) for every piece of every chunk, chunks in parallel.
+// The first chunk runs on the calling thread. The first exception thrown by any chunk is rethrown
+// after all of them finish.
+template <class RangeType, class PieceFunType>
+auto parallel_pieces(RangeType&& range, const parallel_options& options, PieceFunType piece_fun)
+    -> std::size_t {
+  using iterator_type = ring_segment_iterator_t<RangeType>;
+  using difference_type = std::iter_difference_t<iterator_type>;
+
+  auto segments = ring_segments(range);
+  const auto n_segments = static_cast<difference_type>(std::ranges::size(segments));
+  auto segment = [&segments](difference_type index) {
+    return *std::ranges::next(std::ranges::begin(segments), index);
+  };
+
+  // Offset of segment index > 0 is first_size + (index - 1) * lap_size
+  auto first_size = difference_type{0};
+  auto lap_size = difference_type{0};
+  auto total = difference_type{0};
+  if (n_segments > 0) {
+    const auto first = segment(0);
+    first_size = std::ranges::distance(first);
+    total = first_size;
+    if (n_segments > 1) {
+      // The first lap ends at the end of the base, and the second one starts at its beginning
+      lap_size = std::ranges::distance(std::ranges::begin(segment(1)), std::ranges::end(first));
+      total += (n_segments - 2) * lap_size + std::ranges::distance(segment(n_segments - 1));
+    }
+  }
+
+  const auto n_chunks = parallel_threads_count(static_cast<std::size_t>(total), options);
+
+  // The first total % n_chunks chunks take one element more
+  const auto chunk_quot = total / static_cast<difference_type>(n_chunks);
+  const auto chunk_rem = total % static_cast<difference_type>(n_chunks);
+  auto chunk_bound = [&](std::size_t chunk) {
+    const auto index = static_cast<difference_type>(chunk);
+    return chunk_quot * index + std::min(index, chunk_rem);
+  };
+
+  auto run_chunk = [&](std::size_t chunk) {
+    const auto chunk_first = chunk_bound(chunk);
+    const auto chunk_last = chunk_bound(chunk + 1);
+
+    auto index = chunk_first < first_size ? difference_type{0}
+                                          : 1 + (chunk_first - first_size) / lap_size;
+    auto offset = index == 0 ? difference_type{0} : first_size + (index - 1) * lap_size;
+    for (; index < n_segments && offset < chunk_last; ++index) {
+      const auto piece = segment(index);
+      const auto size = std::ranges::distance(piece);
+      const auto piece_first = std::max(chunk_first, offset);
+      const auto piece_last = std::min(chunk_last, offset + size);
+      if (piece_first < piece_last) {
+        const auto begin = std::ranges::begin(piece);
+        piece_fun(chunk, begin + (piece_first - offset), begin + (piece_last - offset),
+                  piece_first);
+      }
+      offset += size;
+    }
+  };
+
+  if (total == 0) {
+    return 0;
+  }
+
+  auto errors = std::vector<std::exception_ptr>(n_chunks);
+  {
+    auto workers = std::vector<std::jthread>();
+    workers.reserve(n_chunks - 1);
+    for (auto chunk = std::size_t{1}; chunk < n_chunks; ++chunk) {
+      workers.emplace_back([&run_chunk, &errors, chunk] {
+        try {
+          run_chunk(chunk);
+        } catch (...) {
+          errors[chunk] = std::current_exception();
+        }
+      });
+    }
+
+    try {
+      run_chunk(0);
+    } catch (...) {
+      errors[0] = std::current_exception();
+    }
+  }
+
+  for (const auto& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+  return n_chunks;
+}
+
+// One empty slot per chunk, for state a chunk keeps over all of its pieces
+template <class ValueType, class RangeType>
+[[nodiscard]] auto parallel_chunk_slots(RangeType&& range, const parallel_options& options)
+    -> std::vector<std::optional<ValueType>> {
+  const auto max_chunks =
+      parallel_threads_count(static_cast<std::size_t>(std::ranges::distance(range)), options);
+  return std::vector<std::optional<ValueType>>(max_chunks);
+}
+
+}  // namespace detail
+
+// == parallel_for_each
+
+// Every chunk calls its own copy of fun, the same one over all of its laps. Laps visit the same
+// base element many times, possibly from different threads, so fun must not modify the elements
+// without synchronization.
+template <detail::ring_parallel_range RangeType, std::copy_constructible FunType>
+  requires std::invocable<FunType&, std::ranges::range_reference_t<RangeType>>
+auto parallel_for_each(RangeType&& range, FunType fun, const parallel_options& options = {})
+    -> void {
+  auto funs = detail::parallel_chunk_slots<FunType>(range, options);
+
+  detail::parallel_pieces(range, options, [&](std::size_t chunk, auto first, auto last, auto) {
+    auto& chunk_fun = funs[chunk];
+    if (!chunk_fun) {
+      chunk_fun.emplace(fun);
+    }
+    std::for_each(first, last, std::ref(*chunk_fun));
+  });
+}
+
+// == parallel_transform
+
+template <detail::ring_parallel_range RangeType, std::random_access_iterator OutIterType,
+          std::copy_constructible FunType>
+  requires std::indirectly_writable<
+      OutIterType, std::invoke_result_t<FunType&, std::ranges::range_reference_t<RangeType>>>
+auto parallel_transform(RangeType&& range, OutIterType out, FunType fun,
+                        const parallel_options& options = {}) -> OutIterType {
+  using out_difference_type = std::iter_difference_t<OutIterType>;
+
+  auto funs = detail::parallel_chunk_slots<FunType>(range, options);
+
+  detail::parallel_pieces(range, options, [&](std::size_t chunk, auto first, auto last,
+                                              auto offset) {
+    auto& chunk_fun = funs[chunk];
+    if (!chunk_fun) {
+      chunk_fun.emplace(fun);
+    }
+    std::transform(first, last, out + static_cast<out_difference_type>(offset),
+                   std::ref(*chunk_fun));
+  });
+  return out + static_cast<out_difference_type>(std::ranges::distance(range));
+}
+
+// == parallel_reduce
+
+// Op must be associative, partial results are combined in the order of the chunks. Like fun of
+// parallel_for_each, every chunk calls its own copy of op.
+template <detail::ring_parallel_range RangeType, std::movable ValueType,
+          std::copy_constructible OpType>
+  requires std::constructible_from<ValueType, std::ranges::range_reference_t<RangeType>>
+           && std::is_invocable_r_v<ValueType, OpType&, ValueType,
+                                    std::ranges::range_reference_t<RangeType>>
+           && std::is_invocable_r_v<ValueType, OpType&, ValueType, ValueType>
+auto parallel_reduce(RangeType&& range, ValueType init, OpType op,
+                     const parallel_options& options = {}) -> ValueType {
+  auto partials = detail::parallel_chunk_slots<ValueType>(range, options);
+  auto ops = detail::parallel_chunk_slots<OpType>(range, options);
+
+  detail::parallel_pieces(range, options, [&](std::size_t chunk, auto first, auto last, auto) {
+    auto& chunk_op = ops[chunk];
+    auto& partial = partials[chunk];
+    if (!partial) {
+      chunk_op.emplace(op);
+      partial.emplace(*first);
+      ++first;
+    }
+    for (; first != last; ++first) {
+      partial = std::invoke(*chunk_op, std::move(*partial), *first);
+    }
+  });
+
+  for (auto& partial : partials) {
+    if (partial) {
+      init = std::invoke(op, std::move(init), std::move(*partial));
+    }
+  }
+  return init;
+}
+
+}  // namespace ranges
+
+}  // namespace dlgr
@@ -0,0 +1,414 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include <gsl/assert>
+
+#include <dlgr/ring_algorithm.h>
+#include <dlgr/ring_view.h>
+
+namespace dlgr {
+
+// == SIMD instruction sets
+
+// Vector kernels are written with GNU vector extensions: vector128 is the baseline vector ISA of
+// the target (SSE2 on x86-64, NEON on AArch64), avx2 is enabled per function and chosen at
+// runtime. Other compilers get the scalar kernels only.
+enum class simd_isa { scalar, vector128, avx2 };
+
+[[nodiscard]] inline auto detected_simd_isa() noexcept -> simd_isa {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  static const auto isa = __builtin_cpu_supports("avx2") ? simd_isa::avx2 : simd_isa::vector128;
+  return isa;
+#elif defined(__GNUC__)
+  return simd_isa::vector128;
+#else
+  return simd_isa::scalar;
+#endif
+}
+
+namespace ranges {
+
+// == Implementation details
+
+namespace detail {
+
+template <class ValueType>
+concept simd_value = std::is_arithmetic_v<ValueType> && !std::same_as<ValueType, bool>;
+
+template <class RangeType>
+concept ring_simd_range = ring_segmented_range<RangeType>
+                          && std::contiguous_iterator<ring_segment_iterator_t<RangeType>>
+                          && simd_value<std::ranges::range_value_t<RangeType>>;
+
+// Integers are summed modulo 2^N in an unsigned type, at least unsigned int so that nothing is
+// promoted to int on the way, and only the result is converted back
+template <class ValueType>
+struct simd_sum {
+  using type = ValueType;
+};
+
+template <std::integral ValueType>
+struct simd_sum<ValueType> {
+  using type = std::common_type_t<std::make_unsigned_t<ValueType>, unsigned int>;
+};
+
+template <class ValueType>
+using simd_sum_t = typename simd_sum<ValueType>::type;
+
+// -- Scalar kernels
+
+struct scalar_kernels {
+  template <class ValueType>
+  static auto sum(const ValueType* data, std::size_t size) noexcept -> ValueType {
+    using sum_type = simd_sum_t<ValueType>;
+    auto res = sum_type{};
+    for (auto idx = std::size_t{0}; idx < size; ++idx) {
+      res += static_cast<sum_type>(data[idx]);  // NOLINT(*-pointer-arithmetic)
+    }
+    return static_cast<ValueType>(res);
+  }
+
+  template <class ValueType>
+  static auto dot(const ValueType* lhs, const ValueType* rhs, std::size_t size) noexcept
+      -> ValueType {
+    using sum_type = simd_sum_t<ValueType>;
+    auto res = sum_type{};
+    for (auto idx = std::size_t{0}; idx < size; ++idx) {
+      // NOLINTNEXTLINE(*-pointer-arithmetic)
+      res += static_cast<sum_type>(lhs[idx]) * static_cast<sum_type>(rhs[idx]);
+    }
+    return static_cast<ValueType>(res);
+  }
+
+  // Size must not be zero
+  template <bool IsMin, class ValueType>
+  static auto extremum(const ValueType* data, std::size_t size) noexcept -> ValueType {
+    auto res = data[0];
+    for (auto idx = std::size_t{1}; idx < size; ++idx) {
+      const auto val = data[idx];  // NOLINT(*-pointer-arithmetic)
+      if (IsMin ? val < res : res < val) {
+        res = val;
+      }
+    }
+    return res;
+  }
+
+  template <class ValueType, class FunType>
+  static auto transform(const ValueType* data, std::size_t size, ValueType* out, FunType& fun)
+      -> void {
+    for (auto idx = std::size_t{0}; idx < size; ++idx) {
+      // NOLINTNEXTLINE(*-pointer-arithmetic)
+      out[idx] = static_cast<ValueType>(std::invoke(fun, data[idx]));
+    }
+  }
+};
+
+#if defined(__GNUC__)
+
+// -- Vector kernels
+
+template <class ValueType, std::size_t Bytes>
+using simd_vector [[gnu::vector_size(Bytes)]] = ValueType;
+
+// Always inlined, so the code is generated for the instruction set of the entry point below
+template <std::size_t Bytes>
+struct vector_kernels {
+  template <class ValueType>
+  using vector_type = simd_vector<ValueType, Bytes>;
+
+  template <class ValueType>
+  constexpr static auto lanes = Bytes / sizeof(ValueType);
+
+  // Independent accumulators hide the latency of the vector adds
+  constexpr static auto n_accumulators = std::size_t{4};
+
+  template <class ValueType>
+  [[gnu::always_inline]] static auto sum(const ValueType* data, std::size_t size) noexcept
+      -> ValueType {
+    return dot_or_sum<false>(data, data, size);
+  }
+
+  template <class ValueType>
+  [[gnu::always_inline]] static auto dot(const ValueType* lhs, const ValueType* rhs,
+                                         std::size_t size) noexcept -> ValueType {
+    return dot_or_sum<true>(lhs, rhs, size);
+  }
+
+  template <bool IsMin, class ValueType>
+  [[gnu::always_inline]] static auto extremum(const ValueType* data, std::size_t size) noexcept
+      -> ValueType {
+    constexpr auto width = lanes<ValueType>;
+    if (size < width) {
+      return scalar_kernels::extremum<IsMin>(data, size);
+    }
+
+    auto acc = vector_type<ValueType>();
+    std::memcpy(&acc, data, sizeof(acc));
+    auto idx = width;
+    for (; idx + width <= size; idx += width) {
+      auto val = vector_type<ValueType>();
+      std::memcpy(&val, data + idx, sizeof(val));  // NOLINT(*-pointer-arithmetic)
+      acc = (IsMin ? val < acc : acc < val) ? val : acc;
+    }
+
+    auto res = acc[0];
+    for (auto lane = std::size_t{1}; lane < width; ++lane) {
+      if (IsMin ? acc[lane] < res : res < acc[lane]) {
+        res = acc[lane];
+      }
+    }
+    if (idx < size) {
+      // NOLINTNEXTLINE(*-pointer-arithmetic)
+      const auto rest = scalar_kernels::extremum<IsMin>(data + idx, size - idx);
+      if (IsMin ? rest < res : res < rest) {
+        res = rest;
+      }
+    }
+    return res;
+  }
+
+  // Functions which take and return whole vectors, e.g. generic lambdas of arithmetic operators,
+  // are called once per vector. Such a generic function must be valid for vector arguments.
+  // Vectors of user functions are 16 bytes wide, as the ABI of wider ones depends on the target.
+  template <class ValueType, class FunType>
+  [[gnu::always_inline]] static auto transform(const ValueType* data, std::size_t size,
+                                               ValueType* out, FunType& fun) -> void {
+    using vec = simd_vector<ValueType, 16>;
+    constexpr auto width = 16 / sizeof(ValueType);
+
+    auto idx = std::size_t{0};
+    if constexpr (std::is_invocable_v<FunType&, vec>) {
+      if constexpr (std::same_as<std::invoke_result_t<FunType&, vec>, vec>) {
+        for (; idx + width <= size; idx += width) {
+          auto val = vec();
+          std::memcpy(&val, data + idx, sizeof(val));  // NOLINT(*-pointer-arithmetic)
+          const vec res = std::invoke(fun, val);
+          std::memcpy(out + idx, &res, sizeof(res));  // NOLINT(*-pointer-arithmetic)
+        }
+      }
+    }
+    // NOLINTNEXTLINE(*-pointer-arithmetic)
+    scalar_kernels::transform(data + idx, size - idx, out + idx, fun);
+  }
+
+ private:
+  template <bool IsDot, class ValueType>
+  [[gnu::always_inline]] static auto dot_or_sum(const ValueType* lhs, const ValueType* rhs,
+                                                std::size_t size) noexcept -> ValueType {
+    // Integers are summed modulo 2^N, which is defined behaviour only for unsigned lanes
+    using lane_type = typename std::conditional_t<std::is_integral_v<ValueType>,
+                                                  std::make_unsigned<ValueType>,
+                                                  std::type_identity<ValueType>>::type;
+    using vec = vector_type<lane_type>;
+    constexpr auto width = lanes<ValueType>;
+    constexpr auto step = width * n_accumulators;
+
+    // std::array would drop the vector attribute of the alias
+    vec acc[n_accumulators] = {};  // NOLINT(*-avoid-c-arrays)
+    auto idx = std::size_t{0};
+    for (; idx + step <= size; idx += step) {
+      for (auto acc_idx = std::size_t{0}; acc_idx < n_accumulators; ++acc_idx) {
+        const auto offset = idx + acc_idx * width;
+        auto val = vec();
+        std::memcpy(&val, lhs + offset, sizeof(val));  // NOLINT(*-pointer-arithmetic)
+        if constexpr (IsDot) {
+          auto other = vec();
+          std::memcpy(&other, rhs + offset, sizeof(other));  // NOLINT(*-pointer-arithmetic)
+          val *= other;
+        }
+        acc[acc_idx] += val;
+      }
+    }
+
+    for (auto acc_idx = std::size_t{1}; acc_idx < n_accumulators; ++acc_idx) {
+      acc[0] += acc[acc_idx];
+    }
+    auto res = lane_type{};
+    for (auto lane = std::size_t{0}; lane < width; ++lane) {
+      res = static_cast<lane_type>(res + acc[0][lane]);
+    }
+
+    // NOLINTBEGIN(*-pointer-arithmetic)
+    const auto rest = IsDot ? scalar_kernels::dot(lhs + idx, rhs + idx, size - idx)
+                            : scalar_kernels::sum(lhs + idx, size - idx);
+    // NOLINTEND(*-pointer-arithmetic)
+    return static_cast<ValueType>(static_cast<lane_type>(res + static_cast<lane_type>(rest)));
+  }
+};
+
+// -- Entry points
+
+// Every operation is a lambda over the kernels, which is flattened into one entry point per
+// instruction set
+template <class OpType>
+[[gnu::flatten]] auto run_vector128(OpType& op) {
+  return op(vector_kernels<16>());
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+template <class OpType>
+[[gnu::target("avx2"), gnu::flatten]] auto run_avx2(OpType& op) {
+  return op(vector_kernels<32>());
+}
+#endif
+
+#endif  // defined(__GNUC__)
+
+template <class OpType>
+auto run_simd(simd_isa isa, OpType op) {
+  Expects(isa <= detected_simd_isa());
+
+  // Branches rather than a switch, which would be left with only a default label elsewhere
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  if (isa == simd_isa::avx2) {
+    return run_avx2(op);
+  }
+#endif
+#if defined(__GNUC__)
+  if (isa == simd_isa::vector128) {
+    return run_vector128(op);
+  }
+#endif
+  return op(scalar_kernels());
+}
+
+template <class SegmentType>
+[[nodiscard]] auto segment_data(const SegmentType& segment) noexcept {
+  return std::to_address(std::ranges::begin(segment));
+}
+
+template <class SegmentType>
+[[nodiscard]] auto segment_size(const SegmentType& segment) noexcept -> std::size_t {
+  return static_cast<std::size_t>(std::ranges::distance(segment));
+}
+
+// At most the head, one whole lap and the tail are scanned
+template <bool IsMin, class RangeType>
+[[nodiscard]] auto simd_extremum(RangeType&& range, simd_isa isa)
+    -> std::ranges::range_value_t<RangeType> {
+  auto laps = split_laps(std::ranges::begin(range), std::ranges::end(range));
+  Expects(!std::ranges::empty(laps.head));
+
+  auto res = std::ranges::range_value_t<RangeType>{};
+  auto has_res = false;
+  for (const auto* segment : {&laps.head, &laps.lap, &laps.tail}) {
+    if (std::ranges::empty(*segment)) {
+      continue;
+    }
+    const auto cur = run_simd(isa, [segment](auto kernels) {
+      return kernels.template extremum<IsMin>(segment_data(*segment),
+                                              segment_size(*segment));
+    });
+    if (!has_res || (IsMin ? cur < res : res < cur)) {
+      res = cur;
+      has_res = true;
+    }
+  }
+  return res;
+}
+
+}  // namespace detail
+
+// Kernels below run over the contiguous base segments of a ring range with vector instructions,
+// and only the seam between laps is handled in scalar code. Sums and dot products of floating
+// point values are reassociated, so they may differ from a left fold by rounding.
+
+// == simd_reduce
+
+// Sum of the elements, every whole lap is summed once and multiplied by the number of laps
+template <detail::ring_simd_range RangeType>
+[[nodiscard]] auto simd_reduce(RangeType&& range, simd_isa isa = detected_simd_isa())
+    -> std::ranges::range_value_t<RangeType> {
+  using value_type = std::ranges::range_value_t<RangeType>;
+  using sum_type = detail::simd_sum_t<value_type>;
+
+  auto laps = detail::split_laps(std::ranges::begin(range), std::ranges::end(range));
+  auto sum = [isa](const auto& segment) {
+    return static_cast<sum_type>(detail::run_simd(isa, [&segment](auto kernels) {
+      return kernels.sum(detail::segment_data(segment), detail::segment_size(segment));
+    }));
+  };
+
+  auto res = sum(laps.head);
+  if (laps.count > 0) {
+    res += sum(laps.lap) * static_cast<sum_type>(laps.count);
+  }
+  res += sum(laps.tail);
+  return static_cast<value_type>(res);
+}
+
+// == simd_dot
+
+// Dot product with a span of the same size, e.g. coefficients of a filter
+template <detail::ring_simd_range RangeType>
+[[nodiscard]] auto simd_dot(RangeType&& range,
+                            std::span<const std::ranges::range_value_t<RangeType>> other,
+                            simd_isa isa = detected_simd_isa())
+    -> std::ranges::range_value_t<RangeType> {
+  using value_type = std::ranges::range_value_t<RangeType>;
+  using sum_type = detail::simd_sum_t<value_type>;
+
+  auto res = sum_type{};
+  auto offset = std::size_t{0};
+  for (auto&& segment : ring_segments(range)) {
+    const auto size = detail::segment_size(segment);
+    Expects(offset + size <= other.size());
+    res += static_cast<sum_type>(detail::run_simd(isa, [&](auto kernels) {
+      return kernels.dot(detail::segment_data(segment), other.data() + offset, size);
+    }));
+    offset += size;
+  }
+  Expects(offset == other.size());
+  return static_cast<value_type>(res);
+}
+
+// == simd_min, simd_max
+
+// NaNs give an unspecified result
+template <detail::ring_simd_range RangeType>
+[[nodiscard]] auto simd_min(RangeType&& range, simd_isa isa = detected_simd_isa())
+    -> std::ranges::range_value_t<RangeType> {
+  return detail::simd_extremum<true>(std::forward<RangeType>(range), isa);
+}
+
+template <detail::ring_simd_range RangeType>
+[[nodiscard]] auto simd_max(RangeType&& range, simd_isa isa = detected_simd_isa())
+    -> std::ranges::range_value_t<RangeType> {
+  return detail::simd_extremum<false>(std::forward<RangeType>(range), isa);
+}
+
+// == simd_transform
+
+template <detail::ring_simd_range RangeType, std::contiguous_iterator OutIterType,
+          std::copy_constructible FunType>
+  requires std::same_as<std::iter_value_t<OutIterType>, std::ranges::range_value_t<RangeType>>
+           && std::indirectly_writable<
+               OutIterType,
+               std::invoke_result_t<FunType&, const std::ranges::range_value_t<RangeType>&>>
+auto simd_transform(RangeType&& range, OutIterType out, FunType fun,
+                    simd_isa isa = detected_simd_isa()) -> OutIterType {
+  for (auto&& segment : ring_segments(range)) {
+    const auto size = detail::segment_size(segment);
+    detail::run_simd(isa, [&](auto kernels) {
+      kernels.transform(detail::segment_data(segment), size, std::to_address(out), fun);
+    });
+    out += static_cast<std::iter_difference_t<OutIterType>>(size);
+  }
+  return out;
+}
+
+}  // namespace ranges
+
+}  // namespace dlgr
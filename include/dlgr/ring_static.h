@@ -0,0 +1,97 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+
+#include <dlgr/ring_view.h>
+
+namespace dlgr {
+
+namespace ranges {
+
+// == ring_to_array implementation
+
+// First Size elements of the range, copied at compile time. Meant for rings over constexpr bases
+// with static storage duration, such as ring_to_array<12>(ring_view(schedule, 3)), and fails to
+// compile if the range has fewer elements.
+template <std::size_t Size, std::ranges::input_range RangeType>
+  requires std::default_initializable<std::ranges::range_value_t<RangeType>>
+[[nodiscard]] consteval auto ring_to_array(RangeType&& range)
+    -> std::array<std::ranges::range_value_t<RangeType>, Size> {
+  auto out = std::array<std::ranges::range_value_t<RangeType>, Size>{};
+  auto iter = std::ranges::begin(range);
+  const auto last = std::ranges::end(range);
+  for (auto& elem : out) {
+    if (iter == last) {
+      throw std::length_error("range is shorter than the array");
+    }
+    elem = *iter;
+    ++iter;
+  }
+  return out;
+}
+
+// == static_ring_view implementation
+
+// Bound laps of a base known at compile time, laid out once in a static table. Iteration is a walk
+// over a contiguous array of a compile-time size, so there is neither a wrap branch nor a bound
+// check left, and a loop over it can be fully unrolled.
+template <const auto& Base, std::size_t Bound>
+  requires(detail::ring_static_extent_v<std::remove_cvref_t<decltype(Base)>> > 0)
+class static_ring_view : public std::ranges::view_interface<static_ring_view<Base, Bound>> {
+  using base_type = std::remove_cvref_t<decltype(Base)>;
+
+ public:
+  // -- Member types
+
+  using value_type = std::ranges::range_value_t<const base_type>;
+  using table_type = std::array<value_type, detail::ring_static_extent_v<base_type> * Bound>;
+
+  // -- Range operations
+
+  [[nodiscard]] constexpr static auto begin() noexcept { return table_.begin(); }
+
+  [[nodiscard]] constexpr static auto end() noexcept { return table_.end(); }
+
+  [[nodiscard]] constexpr static auto size() noexcept -> std::size_t { return table_.size(); }
+
+  // -- Access
+
+  [[nodiscard]] constexpr static auto table() noexcept -> const table_type& { return table_; }
+
+  [[nodiscard]] constexpr static auto base() noexcept -> const base_type& { return Base; }
+
+  [[nodiscard]] constexpr static auto bound() noexcept -> std::size_t { return Bound; }
+
+ private:
+  // -- Data members
+
+  constexpr static table_type table_ =
+      ring_to_array<std::tuple_size_v<table_type>>(ring_view(Base, Bound));
+};
+
+}  // namespace ranges
+
+namespace views {
+
+// == static_ring implementation
+
+template <const auto& Base, std::size_t Bound>
+inline constexpr ranges::static_ring_view<Base, Bound> static_ring = {};
+
+}  // namespace views
+
+}  // namespace dlgr
+
+// == Borrowed ranges
+
+// Iterators point into the static table
+template <const auto& Base, std::size_t Bound>
+inline constexpr bool
+    std::ranges::enable_borrowed_range<dlgr::ranges::static_ring_view<Base, Bound>> = true;
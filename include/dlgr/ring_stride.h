@@ -0,0 +1,497 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <gsl/assert>
+
+#include <dlgr/ring_view.h>
+
+namespace dlgr {
+
+namespace ranges {
+
+// == Implementation details
+
+namespace detail {
+
+struct ring_stride_unused {};
+
+}  // namespace detail
+
+// == ring_stride_view implementation
+
+// Every stride-th element of the endless (or bound laps long) repetition of the base, the same
+// elements as ring_view(base, bound) | std::views::stride(stride) without walking the skipped ones.
+// Over random access bases a step is one modular add, and the orbit length, the number of steps
+// after which the base offsets repeat, is precomputed, so jumps and operator[] are O(1). Other
+// forward bases walk stride % size elements per step.
+template <std::ranges::view ViewType, ring_view_bound BoundType = ring_view_unreachable_bound_t>
+  requires std::ranges::forward_range<ViewType>
+class ring_stride_view
+    : public std::ranges::view_interface<ring_stride_view<ViewType, BoundType>> {
+  constexpr static bool is_bounded_ = std::is_same_v<BoundType, ring_view_bound_t>;
+
+ public:
+  // -- Nested types
+
+  template <bool Const>
+  class iterator;
+
+  // Reached only over an empty base, the unbounded view is endless otherwise
+  class unreachable_sentinel {};
+
+  // -- Member types
+
+  using base_type = ViewType;
+  using bound_type = BoundType;
+  using difference_type = std::ranges::range_difference_t<base_type>;
+
+  // -- Constructors
+
+  [[nodiscard]] constexpr ring_stride_view()
+    requires std::default_initializable<base_type>
+  = default;
+
+  [[nodiscard]] constexpr ring_stride_view(base_type base, difference_type stride,
+                                           bound_type bound = {})
+      : base_(std::move(base)), stride_(stride), bound_{bound} {
+    Expects(stride > 0);
+    validate();
+  }
+
+  // -- Range operations
+
+  [[nodiscard]] constexpr auto begin() -> iterator<false> {
+    return make_iterator<false>(base_, /* at_end */ false);
+  }
+
+  [[nodiscard]] constexpr auto begin() const -> iterator<true>
+    requires std::ranges::forward_range<const base_type>
+  {
+    return make_iterator<true>(base_, /* at_end */ false);
+  }
+
+  // O(n) for bases without size(), like ring_view::end()
+  [[nodiscard]] constexpr auto end() -> iterator<false>
+    requires is_bounded_
+  {
+    return make_iterator<false>(base_, /* at_end */ true);
+  }
+
+  [[nodiscard]] constexpr auto end() const -> iterator<true>
+    requires is_bounded_ && std::ranges::forward_range<const base_type>
+  {
+    return make_iterator<true>(base_, /* at_end */ true);
+  }
+
+  [[nodiscard]] constexpr auto end() const noexcept -> unreachable_sentinel
+    requires(!is_bounded_)
+  {
+    return {};
+  }
+
+  [[nodiscard]] constexpr auto size() const -> std::size_t
+    requires is_bounded_ && std::ranges::sized_range<const base_type>
+  {
+    return steps_count(static_cast<difference_type>(std::ranges::size(base_)));
+  }
+
+  [[nodiscard]] constexpr auto size() -> std::size_t
+    requires is_bounded_ && std::ranges::sized_range<base_type>
+  {
+    return steps_count(static_cast<difference_type>(std::ranges::size(base_)));
+  }
+
+  // -- Access
+
+  [[nodiscard]] constexpr auto stride() const noexcept -> difference_type { return stride_; }
+
+  [[nodiscard]] constexpr auto bound() const noexcept -> bound_type { return bound_; }
+
+  // Number of distinct base elements visited, size / gcd(size, stride), zero for an empty base
+  [[nodiscard]] constexpr auto orbit() const -> std::size_t
+    requires std::ranges::sized_range<const base_type>
+  {
+    return static_cast<std::size_t>(orbit_of(static_cast<difference_type>(std::ranges::size(base_)),
+                                             stride_));
+  }
+
+  [[nodiscard]] constexpr auto base() const& -> base_type
+    requires std::copy_constructible<base_type>
+  {
+    return base_;
+  }
+
+  [[nodiscard]] constexpr auto base() && -> base_type { return std::move(base_); }
+
+ private:
+  // -- Helper functions
+
+  constexpr auto validate() const -> void {
+    if constexpr (is_bounded_ && std::ranges::sized_range<base_type>) {
+      const auto base_size = static_cast<std::size_t>(std::ranges::size(base_));
+      constexpr auto max_size = std::numeric_limits<std::size_t>::max();
+      if (base_size != 0 && bound_ > max_size / base_size) {
+        throw std::overflow_error("bound overflow");
+      }
+    }
+  }
+
+  [[nodiscard]] constexpr static auto orbit_of(difference_type length, difference_type stride)
+      -> difference_type {
+    return length > 0 ? length / std::gcd(length, stride % length) : 0;
+  }
+
+  // Steps in bound laps, the last one may land past the end of the last lap
+  [[nodiscard]] constexpr auto steps_count(difference_type length) const -> std::size_t {
+    const auto total = bound_ * static_cast<std::size_t>(length);
+    const auto stride = static_cast<std::size_t>(stride_);
+    return total / stride + (total % stride != 0 ? 1 : 0);
+  }
+
+  // The base may change its size after construction, so the length is found anew every time
+  template <bool Const, class BaseType>
+  [[nodiscard]] constexpr auto make_iterator(BaseType& base, bool at_end) const
+      -> iterator<Const> {
+    using iterator_type = iterator<Const>;
+
+    auto first = std::ranges::begin(base);
+    auto last = std::ranges::end(base);
+    const auto length = std::ranges::distance(first, last);
+    const auto step = length > 0 ? stride_ % length : 0;
+    const auto orbit = std::max(orbit_of(length, stride_), difference_type{1});
+
+    auto pos = difference_type{0};
+    if constexpr (is_bounded_) {
+      if (at_end) {
+        pos = static_cast<difference_type>(steps_count(length));
+      }
+    }
+
+    auto curr = typename iterator_type::cursor_type{};
+    if constexpr (iterator_type::is_random_access_) {
+      curr = length > 0 ? pos % orbit * step % length : 0;
+    } else {
+      // Only the position of the end iterator matters
+      curr = first;
+    }
+
+    auto end = typename iterator_type::end_type{};
+    if constexpr (!iterator_type::is_random_access_) {
+      end = std::move(last);
+    }
+
+    return iterator_type(std::move(first), std::move(end), std::move(curr), length, step, orbit,
+                         pos);
+  }
+
+  // -- Data members
+
+  base_type base_ = {};
+  difference_type stride_ = 1;
+  bound_type bound_ = {};
+};
+
+// == ring_stride_view::iterator implementation
+
+template <std::ranges::view ViewType, ring_view_bound BoundType>
+  requires std::ranges::forward_range<ViewType>
+template <bool Const>
+class ring_stride_view<ViewType, BoundType>::iterator {
+  friend class ring_stride_view<ViewType, BoundType>;
+
+  using parent_base_type = std::conditional_t<Const, const ViewType, ViewType>;
+
+  constexpr static bool is_random_access_ = std::ranges::random_access_range<parent_base_type>;
+
+ public:
+  // -- Member types
+
+  using base_iterator_type = std::ranges::iterator_t<parent_base_type>;
+
+  using difference_type = std::iter_difference_t<base_iterator_type>;
+  using value_type = std::iter_value_t<base_iterator_type>;
+  using reference = std::iter_reference_t<base_iterator_type>;
+  using iterator_concept = std::conditional_t<is_random_access_, std::random_access_iterator_tag,
+                                              std::forward_iterator_tag>;
+  using iterator_category = detail::min_iterator_category_t<
+      typename std::iterator_traits<base_iterator_type>::iterator_category, iterator_concept>;
+
+  // -- Constructors
+
+  [[nodiscard]] constexpr iterator() = default;
+
+  [[nodiscard]] constexpr iterator(const iterator<!Const>& non_const_iter)
+    requires Const
+             && std::convertible_to<std::ranges::iterator_t<ViewType>, base_iterator_type>
+      : begin_(non_const_iter.begin_),
+        end_(non_const_iter.end_),
+        curr_(non_const_iter.curr_),
+        length_(non_const_iter.length_),
+        step_(non_const_iter.step_),
+        orbit_(non_const_iter.orbit_),
+        pos_(non_const_iter.pos_) {}
+
+  // -- Data access
+
+  [[nodiscard]] constexpr auto operator*() const -> reference {
+    if constexpr (is_random_access_) {
+      Expects(length_ > 0);
+      return begin_[curr_];
+    } else {
+      return *curr_;
+    }
+  }
+
+  [[nodiscard]] constexpr auto operator[](difference_type diff) const -> reference
+    requires is_random_access_
+  {
+    return *(*this + diff);
+  }
+
+  // Index of the current element in the base
+  [[nodiscard]] constexpr auto base_offset() const -> difference_type
+    requires is_random_access_
+  {
+    return curr_;
+  }
+
+  // -- Operations
+
+  constexpr auto operator++() -> iterator& {
+    ++pos_;
+    if constexpr (is_random_access_) {
+      curr_ += step_;
+      if (curr_ >= length_) {
+        curr_ -= length_;
+      }
+    } else {
+      // Step is less than the length, so the walk wraps at most once
+      const auto left = std::ranges::advance(curr_, step_, end_);
+      if (curr_ == end_) {
+        curr_ = begin_;
+        std::ranges::advance(curr_, left);
+      }
+    }
+    return *this;
+  }
+
+  constexpr auto operator++(int) -> iterator {
+    auto iter = *this;
+    ++*this;
+    return iter;
+  }
+
+  constexpr auto operator--() -> iterator&
+    requires is_random_access_
+  {
+    --pos_;
+    curr_ -= step_;
+    if (curr_ < 0) {
+      curr_ += length_;
+    }
+    return *this;
+  }
+
+  constexpr auto operator--(int) -> iterator
+    requires is_random_access_
+  {
+    auto iter = *this;
+    --*this;
+    return iter;
+  }
+
+  // Offsets repeat every orbit steps, so the shift is reduced to less than a full orbit first
+  constexpr auto operator+=(difference_type diff) -> iterator&
+    requires is_random_access_
+  {
+    pos_ += diff;
+    if (length_ > 0) {
+      auto steps = diff % orbit_;
+      if (steps < 0) {
+        steps += orbit_;
+      }
+      curr_ = (curr_ + steps * step_ % length_) % length_;
+    }
+    return *this;
+  }
+
+  constexpr auto operator-=(difference_type diff) -> iterator&
+    requires is_random_access_
+  {
+    return *this += -diff;
+  }
+
+  // -- Non-member operations
+
+  [[nodiscard]] constexpr friend auto operator+(iterator iter, difference_type diff) -> iterator
+    requires is_random_access_
+  {
+    iter += diff;
+    return iter;
+  }
+
+  [[nodiscard]] constexpr friend auto operator+(difference_type diff, iterator iter) -> iterator
+    requires is_random_access_
+  {
+    iter += diff;
+    return iter;
+  }
+
+  [[nodiscard]] constexpr friend auto operator-(iterator iter, difference_type diff) -> iterator
+    requires is_random_access_
+  {
+    iter -= diff;
+    return iter;
+  }
+
+  [[nodiscard]] constexpr friend auto operator-(const iterator& lhs, const iterator& rhs)
+      -> difference_type
+    requires is_random_access_
+  {
+    return lhs.pos_ - rhs.pos_;
+  }
+
+  // -- Comparison
+
+  // Iterators of one view differ only in the number of steps taken
+  [[nodiscard]] constexpr friend auto operator==(const iterator& lhs, const iterator& rhs) -> bool {
+    return lhs.pos_ == rhs.pos_;
+  }
+
+  [[nodiscard]] constexpr friend auto operator<=>(const iterator& lhs, const iterator& rhs)
+      -> std::strong_ordering {
+    return lhs.pos_ <=> rhs.pos_;
+  }
+
+  // -- Sentinel equality comparison
+
+  [[nodiscard]] constexpr auto operator==(
+      [[maybe_unused]] const unreachable_sentinel& sen) const noexcept -> bool
+    requires(!is_bounded_)
+  {
+    return length_ == 0;
+  }
+
+  [[nodiscard]] constexpr friend auto operator==(const unreachable_sentinel& sen,
+                                                 const iterator& iter) noexcept -> bool
+    requires(!is_bounded_)
+  {
+    return iter == sen;
+  }
+
+ private:
+  // -- Member types
+
+  // Random access iterators keep the base offset and need no base end
+  using cursor_type = std::conditional_t<is_random_access_, difference_type, base_iterator_type>;
+  using end_type = std::conditional_t<is_random_access_, detail::ring_stride_unused,
+                                      std::ranges::sentinel_t<parent_base_type>>;
+
+  // -- Constructors
+
+  [[nodiscard]] constexpr iterator(base_iterator_type begin, end_type end, cursor_type curr,
+                                   difference_type length, difference_type step,
+                                   difference_type orbit, difference_type pos)
+      : begin_(std::move(begin)),
+        end_(std::move(end)),
+        curr_(std::move(curr)),
+        length_(length),
+        step_(step),
+        orbit_(orbit),
+        pos_(pos) {}
+
+  // -- Data members
+
+  template <bool>
+  friend class iterator;
+
+  base_iterator_type begin_ = {};
+  [[no_unique_address]] end_type end_ = {};
+  cursor_type curr_ = {};
+  difference_type length_ = 0;
+  // Stride modulo the length
+  difference_type step_ = 0;
+  difference_type orbit_ = 1;
+  difference_type pos_ = 0;
+};
+
+// == ring_stride_view deduction guides
+
+template <std::ranges::forward_range RangeType, std::integral BoundType>
+ring_stride_view(RangeType&&, std::ranges::range_difference_t<RangeType>, BoundType)
+    -> ring_stride_view<std::views::all_t<RangeType>, ring_view_bound_t>;
+
+template <std::ranges::forward_range RangeType>
+ring_stride_view(RangeType&&, std::ranges::range_difference_t<RangeType>,
+                 ring_view_unreachable_bound_t)
+    -> ring_stride_view<std::views::all_t<RangeType>, ring_view_unreachable_bound_t>;
+
+template <std::ranges::forward_range RangeType>
+ring_stride_view(RangeType&&, std::ranges::range_difference_t<RangeType>)
+    -> ring_stride_view<std::views::all_t<RangeType>>;
+
+}  // namespace ranges
+
+namespace views {
+
+// == ring_stride implementation
+
+// TODO(compiler): Use range_adaptor_closure
+template <ranges::ring_view_bound BoundType = ranges::ring_view_unreachable_bound_t>
+class ring_stride {
+ public:
+  using bound_type = BoundType;
+
+  [[nodiscard]] constexpr explicit ring_stride(std::ptrdiff_t stride,
+                                               bound_type bound = {}) noexcept
+      : stride_(stride), bound_(bound) {}
+
+  template <std::ranges::viewable_range RangeType>
+    requires std::ranges::forward_range<std::views::all_t<RangeType>>
+  [[nodiscard]] constexpr auto operator()(RangeType&& range) const {
+    using difference_type = std::ranges::range_difference_t<RangeType>;
+    return ranges::ring_stride_view(std::views::all(std::forward<RangeType>(range)),
+                                    static_cast<difference_type>(stride_), bound_);
+  }
+
+ private:
+  std::ptrdiff_t stride_ = 1;
+  bound_type bound_ = {};
+};
+
+template <std::ranges::viewable_range RangeType, ranges::ring_view_bound BoundType>
+  requires std::ranges::forward_range<std::views::all_t<RangeType>>
+constexpr auto operator|(RangeType&& range, const ring_stride<BoundType>& stride) {
+  return stride(std::forward<RangeType>(range));
+}
+
+// == ring_stride deduction guides
+
+template <std::integral BoundType>
+ring_stride(std::ptrdiff_t, BoundType) -> ring_stride<ranges::ring_view_bound_t>;
+
+}  // namespace views
+
+}  // namespace dlgr
+
+// == Borrowed ranges
+
+// Like ring_view, iterators hold base iterators and offsets only
+template <std::ranges::view ViewType, dlgr::ranges::ring_view_bound BoundType>
+  requires std::ranges::forward_range<ViewType>
+inline constexpr bool
+    std::ranges::enable_borrowed_range<dlgr::ranges::ring_stride_view<ViewType, BoundType>> =
+        std::ranges::enable_borrowed_range<ViewType>;
@@ -2,17 +2,23 @@
 
 #pragma once
 
+#include <array>
+#include <compare>
 #include <concepts>
+#include <cstddef>
 #include <cstdlib>
 #include <iterator>
 #include <limits>
 #include <ranges>
+#include <span>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
 
 #include <gsl/assert>
 
+#include <dlgr/fast_divisor.h>
+
 namespace dlgr {
 
 // == Utility concepts
@@ -32,25 +38,148 @@ concept ring_view_bound = is_any_of<T, ring_view_bound_t, ring_view_unreachable_
 
 constexpr inline ring_view_unreachable_bound_t ring_view_unreachable_bound = {};
 
+// == Contract policies
+
+// Preconditions of iterator ops are checked, the default
+struct ring_view_check_contracts_t {
+  // NOLINTNEXTLINE(runtime/explicit): Explicit default ctor for tag type
+  constexpr explicit ring_view_check_contracts_t() noexcept = default;
+};
+
+inline constexpr ring_view_check_contracts_t ring_view_check_contracts{};
+
+// Preconditions of iterator ops are only assumed, for trusted hot loops. Breaking one is undefined
+// behavior.
+struct ring_view_assume_contracts_t {
+  // NOLINTNEXTLINE(runtime/explicit): Explicit default ctor for tag type
+  constexpr explicit ring_view_assume_contracts_t() noexcept = default;
+};
+
+inline constexpr ring_view_assume_contracts_t ring_view_assume_contracts{};
+
+template <class T>
+concept ring_view_contract_policy =
+    is_any_of<T, ring_view_check_contracts_t, ring_view_assume_contracts_t>;
+
+// == Implementation details declarations
+
+namespace detail {
+
+struct ring_no_length {};
+
+// Size of the base known at compile time, zero if it is not
+template <class RangeType>
+inline constexpr std::size_t ring_static_extent_v = 0;
+
+template <class ValueType, std::size_t Extent>
+inline constexpr std::size_t ring_static_extent_v<std::span<ValueType, Extent>> =
+    Extent != std::dynamic_extent ? Extent : 0;
+
+template <class ValueType, std::size_t Extent>
+inline constexpr std::size_t ring_static_extent_v<std::array<ValueType, Extent>> = Extent;
+
+template <class ValueType, std::size_t Extent>
+inline constexpr std::size_t ring_static_extent_v<ValueType[Extent]> = Extent;
+
+template <class RangeType>
+inline constexpr std::size_t ring_static_extent_v<std::ranges::ref_view<RangeType>> =
+    ring_static_extent_v<std::remove_cv_t<RangeType>>;
+
+template <class RangeType>
+inline constexpr std::size_t ring_static_extent_v<std::ranges::owning_view<RangeType>> =
+    ring_static_extent_v<RangeType>;
+
+// Base end as an iterator, which bidirectional and random access ops need, is only known without
+// a walk over the base for common ranges and random access ranges with a sized sentinel. Other
+// bases keep their sentinel, which is all forward iteration needs.
+template <class RangeType>
+concept ring_end_iterator_range =
+    std::ranges::common_range<RangeType>
+    || (std::ranges::random_access_range<RangeType>
+        && std::sized_sentinel_for<std::ranges::sentinel_t<RangeType>,
+                                   std::ranges::iterator_t<RangeType>>);
+
+template <class RangeType>
+concept ring_bidirectional_range =
+    std::ranges::bidirectional_range<RangeType> && ring_end_iterator_range<RangeType>;
+
+template <class RangeType>
+concept ring_random_access_range =
+    std::ranges::random_access_range<RangeType> && ring_end_iterator_range<RangeType>;
+
+template <class RangeType>
+using ring_end_t = std::conditional_t<ring_end_iterator_range<RangeType>,
+                                      std::ranges::iterator_t<RangeType>,
+                                      std::ranges::sentinel_t<RangeType>>;
+
+template <class RangeType>
+[[nodiscard]] constexpr auto ring_end_of(const std::ranges::iterator_t<RangeType>& begin,
+                                         std::ranges::sentinel_t<RangeType> end)
+    -> ring_end_t<RangeType> {
+  if constexpr (std::ranges::common_range<RangeType> || !ring_end_iterator_range<RangeType>) {
+    return end;
+  } else {
+    return begin + (end - begin);
+  }
+}
+
+// Lap length is cached only where random access ops need it
+template <class RangeType>
+struct ring_length {
+  using type = ring_no_length;
+};
+
+template <ring_random_access_range RangeType>
+struct ring_length<RangeType> {
+  using type = fast_divisor<std::ranges::range_difference_t<RangeType>>;
+};
+
+template <class RangeType>
+using ring_length_t = typename ring_length<RangeType>::type;
+
+template <ring_view_contract_policy ContractPolicy>
+constexpr auto ring_expects(bool cond) -> void {
+  if constexpr (std::is_same_v<ContractPolicy, ring_view_assume_contracts_t>) {
+    GSL_ASSUME(cond);
+  } else {
+    Expects(cond);
+  }
+}
+
+}  // namespace detail
+
 // == ring_view implementation
 
 template <std::ranges::forward_range RangeType,
-          ring_view_bound BoundType = ring_view_unreachable_bound_t>
-class ring_view : public std::ranges::view_interface<ring_view<RangeType, BoundType>> {
+          ring_view_bound BoundType = ring_view_unreachable_bound_t,
+          ring_view_contract_policy ContractPolicy = ring_view_check_contracts_t>
+class ring_view
+    : public std::ranges::view_interface<ring_view<RangeType, BoundType, ContractPolicy>> {
   constexpr static bool is_bounded_ = std::is_same_v<BoundType, ring_view_bound_t>;
 
+  // Bounded rings over contiguous bases of a compile-time size get the compact iterator
+  constexpr static auto static_extent_ = detail::ring_static_extent_v<RangeType>;
+  constexpr static bool is_compact_ = is_bounded_ && static_extent_ > 0
+                                      && std::ranges::contiguous_range<RangeType>
+                                      && std::ranges::contiguous_range<const RangeType>;
+
  public:
   // -- Nested types
   template <bool Const>
   class iterator;
 
+  template <bool Const>
+  class compact_iterator;
+
   class unreachable_sentinel {};
 
   // -- Member types
   using base_type = RangeType;
   using bound_type = BoundType;
-  using iterator_type = iterator<false>;
-  using const_iterator_type = iterator<true>;
+  using contract_policy = ContractPolicy;
+  using iterator_type = std::conditional_t<is_compact_, compact_iterator<false>, iterator<false>>;
+  using const_iterator_type =
+      std::conditional_t<is_compact_, compact_iterator<true>, iterator<true>>;
   using sentinel_type = std::conditional_t<is_bounded_, iterator_type, unreachable_sentinel>;
   using const_sentinel_type =
       std::conditional_t<is_bounded_, const_iterator_type, unreachable_sentinel>;
@@ -64,50 +193,31 @@ class ring_view : public std::ranges::view_interface<ring_view<RangeType, BoundT
   [[nodiscard]] constexpr explicit ring_view(base_type base, bound_type bound = {})
       : base_(std::move(base)), bound_{bound} {
     validate();
+    cache_length();
   }
 
+  [[nodiscard]] constexpr ring_view([[maybe_unused]] contract_policy policy, base_type base,
+                                    bound_type bound = {})
+      : ring_view(std::move(base), bound) {}
+
   // -- Range operation
 
-  [[nodiscard]] constexpr auto begin() -> iterator_type {
-    auto base_begin = std::ranges::begin(base_);
-    auto base_end = std::ranges::end(base_);
-    return {
-        /* begin */ base_begin,
-        /* end   */ base_end,
-    };
-  }
+  [[nodiscard]] constexpr auto begin() -> iterator_type { return make_begin<iterator_type>(base_); }
 
   [[nodiscard]] constexpr auto begin() const -> const_iterator_type {
-    auto base_begin = std::ranges::begin(base_);
-    auto base_end = std::ranges::end(base_);
-    return {
-        /* begin */ base_begin,
-        /* end   */ base_end,
-    };
+    return make_begin<const_iterator_type>(base_);
   }
 
   [[nodiscard]] constexpr auto end() -> iterator_type
     requires is_bounded_
   {
-    auto base_begin = std::ranges::begin(base_);
-    auto base_end = std::ranges::end(base_);
-    return {
-        /* begin */ base_begin,
-        /* end   */ base_end,
-        /* pos   */ base_begin != base_end ? bound_ : bound_type{},
-    };
+    return make_end<iterator_type>(base_);
   }
 
   [[nodiscard]] constexpr auto end() const -> const_iterator_type
     requires is_bounded_
   {
-    auto base_begin = std::ranges::begin(base_);
-    auto base_end = std::ranges::end(base_);
-    return {
-        /* begin */ base_begin,
-        /* end   */ base_end,
-        /* pos   */ base_begin != base_end ? bound_ : bound_type{},
-    };
+    return make_end<const_iterator_type>(base_);
   }
 
   [[nodiscard]] constexpr auto end() const -> unreachable_sentinel
@@ -150,6 +260,20 @@ class ring_view : public std::ranges::view_interface<ring_view<RangeType, BoundT
     return std::ranges::empty(base_);
   }
 
+  // -- Segments
+
+  [[nodiscard]] constexpr auto segments()
+    requires is_bounded_
+  {
+    return ring_segments(begin(), end());
+  }
+
+  [[nodiscard]] constexpr auto segments() const
+    requires is_bounded_
+  {
+    return ring_segments(begin(), end());
+  }
+
   // -- Base access
 
   [[nodiscard]] constexpr auto base() const& -> base_type
@@ -164,8 +288,8 @@ class ring_view : public std::ranges::view_interface<ring_view<RangeType, BoundT
   // -- Helper functions
 
   constexpr auto validate() const
-      noexcept(!is_bounded_ || !std::ranges::random_access_range<base_type>) -> void {
-    if constexpr (is_bounded_ && std::ranges::random_access_range<base_type>) {
+      noexcept(!is_bounded_ || !detail::ring_random_access_range<base_type>) -> void {
+    if constexpr (is_bounded_ && detail::ring_random_access_range<base_type>) {
       const auto base_size = std::ranges::size(base_);
       constexpr auto max_size = std::numeric_limits<decltype(base_size)>::max();
       if (base_size != 0 && bound_ > static_cast<bound_type>(max_size / base_size)) {
@@ -175,10 +299,86 @@ class ring_view : public std::ranges::view_interface<ring_view<RangeType, BoundT
     }
   }
 
+  template <class IterType, class BaseType>
+  [[nodiscard]] constexpr auto make_begin(BaseType& base) const -> IterType {
+    if constexpr (is_compact_) {
+      return IterType(std::ranges::begin(base));
+    } else {
+      auto base_begin = std::ranges::begin(base);
+      auto base_end = detail::ring_end_of<BaseType>(base_begin, std::ranges::end(base));
+      auto length = length_of<IterType>(base_begin, base_end);
+      return {
+          /* begin  */ std::move(base_begin),
+          /* end    */ std::move(base_end),
+          /* length */ std::move(length),
+      };
+    }
+  }
+
+  template <class IterType, class BaseType>
+  [[nodiscard]] constexpr auto make_end(BaseType& base) const -> IterType {
+    if constexpr (is_compact_) {
+      return IterType(std::ranges::begin(base), compact_end_index());
+    } else {
+      auto base_begin = std::ranges::begin(base);
+      auto base_end = detail::ring_end_of<BaseType>(base_begin, std::ranges::end(base));
+      auto length = length_of<IterType>(base_begin, base_end);
+      const auto pos = base_begin != base_end ? bound_ : bound_type{};
+      return {
+          /* begin  */ std::move(base_begin),
+          /* end    */ std::move(base_end),
+          /* length */ std::move(length),
+          /* pos    */ pos,
+      };
+    }
+  }
+
+  [[nodiscard]] constexpr auto compact_end_index() const -> std::ptrdiff_t
+    requires is_compact_
+  {
+    constexpr auto max_bound =
+        static_cast<bound_type>(std::numeric_limits<std::ptrdiff_t>::max()) / static_extent_;
+    Expects(bound_ <= max_bound);
+    return static_cast<std::ptrdiff_t>(bound_ * static_extent_);
+  }
+
+  constexpr auto cache_length() -> void {
+    if constexpr (detail::ring_random_access_range<base_type>) {
+      const auto len = std::ranges::distance(base_);
+      if (len > 0) {
+        length_ = length_type(len);
+      }
+    }
+  }
+
+  // The base may change its size after construction, so the cached length is only a hint
+  template <class IterType, class BaseIterType, class BaseEndType>
+  [[nodiscard]] constexpr auto length_of(const BaseIterType& base_begin,
+                                         const BaseEndType& base_end) const ->
+      typename IterType::length_type {
+    using iter_length_type = typename IterType::length_type;
+    if constexpr (std::is_same_v<iter_length_type, detail::ring_no_length>) {
+      return {};
+    } else {
+      const auto len = std::ranges::distance(base_begin, base_end);
+      if constexpr (std::is_same_v<iter_length_type, length_type>) {
+        if (len == length_.value()) {
+          return length_;
+        }
+      }
+      return len > 0 ? iter_length_type(len) : iter_length_type();
+    }
+  }
+
+  // -- Member types
+
+  using length_type = detail::ring_length_t<base_type>;
+
   // -- Data members
 
   base_type base_;
   bound_type bound_ = {};
+  [[no_unique_address]] length_type length_ = {};
 };
 
 // == Utility funtions implementation details of
@@ -192,17 +392,21 @@ using min_iterator_category_t = std::conditional_t<std::is_base_of_v<Tag1, Tag2>
 
 // == ring_view::iterator implementation
 
-template <std::ranges::forward_range RangeType, ring_view_bound BoundType>
+template <std::ranges::forward_range RangeType, ring_view_bound BoundType,
+          ring_view_contract_policy ContractPolicy>
 template <bool Const>
-class ring_view<RangeType, BoundType>::iterator {
-  using parent_type = std::conditional_t<Const, std::add_const_t<ring_view<RangeType, BoundType>>,
-                                         ring_view<RangeType, BoundType>>;
-  friend class ring_view<RangeType, BoundType>;
+class ring_view<RangeType, BoundType, ContractPolicy>::iterator {
+  using parent_type =
+      std::conditional_t<Const, std::add_const_t<ring_view<RangeType, BoundType, ContractPolicy>>,
+                         ring_view<RangeType, BoundType, ContractPolicy>>;
+  friend class ring_view<RangeType, BoundType, ContractPolicy>;
 
   using parent_base_type =
       std::conditional_t<Const, std::add_const_t<typename parent_type::base_type>,
                          typename parent_type::base_type>;
   using bound_type = typename parent_type::bound_type;
+  using length_type = detail::ring_length_t<parent_base_type>;
+  using end_type = detail::ring_end_t<parent_base_type>;
   using sentinel = typename parent_type::unreachable_sentinel;
 
   constexpr static bool is_bounded_ = std::is_same_v<bound_type, ring_view_bound_t>;
@@ -220,8 +424,19 @@ class ring_view<RangeType, BoundType>::iterator {
       std::conditional_t<is_bounded_,
                          detail::min_iterator_category_t<
                              typename std::iterator_traits<base_iterator_type>::iterator_category,
-                             std::random_access_iterator_tag>,
+                             std::conditional_t<detail::ring_end_iterator_range<parent_base_type>,
+                                                std::random_access_iterator_tag,
+                                                std::forward_iterator_tag>>,
                          std::input_iterator_tag>;
+  // Iterators of generated bases return prvalues and are only C++17 input iterators, but they
+  // still model the C++20 concepts
+  using iterator_concept = std::conditional_t<
+      is_bounded_,
+      std::conditional_t<
+          detail::ring_random_access_range<parent_base_type>, std::random_access_iterator_tag,
+          std::conditional_t<detail::ring_bidirectional_range<parent_base_type>,
+                             std::bidirectional_iterator_tag, std::forward_iterator_tag>>,
+      std::input_iterator_tag>;
 
   // -- Constructors
 
@@ -243,6 +458,7 @@ class ring_view<RangeType, BoundType>::iterator {
       : curr_(non_const_iter.curr_),
         begin_(non_const_iter.begin_),
         end_(non_const_iter.end_),
+        len_(convert_length(non_const_iter.len_)),
         pos_(non_const_iter.pos_) {}
 
   // -- Destructor
@@ -270,7 +486,7 @@ class ring_view<RangeType, BoundType>::iterator {
   }
 
   [[nodiscard]] constexpr auto operator[](difference_type diff) const -> reference
-    requires std::ranges::random_access_range<parent_base_type>
+    requires detail::ring_random_access_range<parent_base_type>
              && std::signed_integral<difference_type>
   {
     return (*this + diff).access();
@@ -287,13 +503,13 @@ class ring_view<RangeType, BoundType>::iterator {
   }
 
   constexpr auto operator--() -> iterator&
-    requires std::ranges::bidirectional_range<parent_base_type>
+    requires detail::ring_bidirectional_range<parent_base_type>
   {
     return dec();
   }
 
   constexpr auto operator--(int) -> iterator
-    requires std::ranges::bidirectional_range<parent_base_type>
+    requires detail::ring_bidirectional_range<parent_base_type>
   {
     auto iter = *this;
     dec();
@@ -301,14 +517,14 @@ class ring_view<RangeType, BoundType>::iterator {
   }
 
   constexpr auto operator+=(difference_type diff) -> iterator&
-    requires std::ranges::random_access_range<parent_base_type>
+    requires detail::ring_random_access_range<parent_base_type>
              && std::signed_integral<difference_type>
   {
     return diff > 0 ? add(diff) : diff < 0 ? sub(-diff) : (*this);
   }
 
   constexpr auto operator-=(difference_type diff) -> iterator&
-    requires std::ranges::random_access_range<parent_base_type>
+    requires detail::ring_random_access_range<parent_base_type>
              && std::signed_integral<difference_type>
   {
     return diff > 0 ? sub(diff) : diff < 0 ? add(-diff) : (*this);
@@ -331,7 +547,7 @@ class ring_view<RangeType, BoundType>::iterator {
   // -- Non-member operations
 
   [[nodiscard]] constexpr friend auto operator+(iterator iter, difference_type diff) -> iterator
-    requires std::ranges::random_access_range<parent_base_type>
+    requires detail::ring_random_access_range<parent_base_type>
              && std::signed_integral<difference_type>
   {
     iter += diff;
@@ -339,7 +555,7 @@ class ring_view<RangeType, BoundType>::iterator {
   }
 
   [[nodiscard]] constexpr friend auto operator+(difference_type diff, iterator iter) -> iterator
-    requires std::ranges::random_access_range<parent_base_type>
+    requires detail::ring_random_access_range<parent_base_type>
              && std::signed_integral<difference_type>
   {
     iter += diff;
@@ -347,7 +563,7 @@ class ring_view<RangeType, BoundType>::iterator {
   }
 
   [[nodiscard]] constexpr friend auto operator-(iterator iter, difference_type diff) -> iterator
-    requires std::ranges::random_access_range<parent_base_type>
+    requires detail::ring_random_access_range<parent_base_type>
              && std::signed_integral<difference_type>
   {
     iter -= diff;
@@ -355,7 +571,7 @@ class ring_view<RangeType, BoundType>::iterator {
   }
 
   [[nodiscard]] constexpr friend auto operator-(difference_type diff, iterator iter) -> iterator
-    requires std::ranges::random_access_range<parent_base_type>
+    requires detail::ring_random_access_range<parent_base_type>
              && std::signed_integral<difference_type>
   {
     iter -= diff;
@@ -364,7 +580,7 @@ class ring_view<RangeType, BoundType>::iterator {
 
   [[nodiscard]] constexpr friend auto operator-(const iterator& lhs, const iterator& rhs)
       -> difference_type
-    requires is_bounded_ && std::ranges::random_access_range<parent_base_type>
+    requires is_bounded_ && detail::ring_random_access_range<parent_base_type>
              && std::signed_integral<difference_type>
   {
     expects_same_range(lhs, rhs);
@@ -414,15 +630,50 @@ class ring_view<RangeType, BoundType>::iterator {
     return lhs.pos_ > rhs.pos_ || (lhs.pos_ == rhs.pos_ && lhs.curr_ >= rhs.curr_);
   }
 
+  // -- Segments
+
+  // Splits [first, last) into contiguous subranges of the base, one per lap. The first and the
+  // last lap may be partial. Bases with a sentinel are walked once to find their end.
+  [[nodiscard]] constexpr friend auto ring_segments(const iterator& first, const iterator& last)
+    requires is_bounded_
+  {
+    expects_same_range(first, last);
+    expects(first.pos_ <= last.pos_);
+
+    auto laps_end = last.pos_;
+    if (last.curr_ != last.begin_ && (last.pos_ != first.pos_ || last.curr_ != first.curr_)) {
+      ++laps_end;
+    }
+
+    return std::views::iota(first.pos_, laps_end)
+           | std::views::transform([first_pos = first.pos_, first_curr = first.curr_,
+                                    last_pos = last.pos_, last_curr = last.curr_,
+                                    begin = first.begin_,
+                                    end = first.end_iterator()](bound_type pos) {
+               return std::ranges::subrange<base_iterator_type>(
+                   /* begin */ pos == first_pos ? first_curr : begin,
+                   /* end   */ pos == last_pos ? last_curr : end);
+             });
+  }
+
  private:
   // -- Constructor
 
-  [[nodiscard]] constexpr iterator(base_iterator_type begin, base_iterator_type end,
+  [[nodiscard]] constexpr iterator(base_iterator_type begin, end_type end, length_type len,
                                    bound_type pos = {})
-      : curr_{begin}, begin_{std::move(begin)}, end_{std::move(end)}, pos_{pos} {}
+      : curr_{begin}, begin_{std::move(begin)}, end_{std::move(end)}, len_{len}, pos_{pos} {}
 
   // -- Helper functions
 
+  // A walk over the whole base when it only has a sentinel
+  [[nodiscard]] constexpr auto end_iterator() const -> base_iterator_type {
+    if constexpr (std::is_same_v<end_type, base_iterator_type>) {
+      return end_;
+    } else {
+      return std::ranges::next(begin_, end_);
+    }
+  }
+
   [[nodiscard]] constexpr auto access() const -> reference {
     expects_not_empty();
     return *curr_;
@@ -434,7 +685,7 @@ class ring_view<RangeType, BoundType>::iterator {
     ++curr_;
     if (curr_ == end_) {
       if constexpr (is_bounded_) {
-        Expects(pos_ <= std::numeric_limits<bound_type>::max() - 1);
+        expects(pos_ <= std::numeric_limits<bound_type>::max() - 1);
         ++pos_;
       }
       curr_ = begin_;
@@ -444,14 +695,14 @@ class ring_view<RangeType, BoundType>::iterator {
   }
 
   constexpr auto dec() -> iterator&
-    requires std::ranges::bidirectional_range<parent_base_type>
+    requires detail::ring_bidirectional_range<parent_base_type>
   {
     expects_not_empty();
 
     if (curr_ == begin_) {
       curr_ = end_;
       if constexpr (is_bounded_) {
-        Expects(pos_ >= std::numeric_limits<bound_type>::min() + 1);
+        expects(pos_ >= std::numeric_limits<bound_type>::min() + 1);
         --pos_;
       }
     }
@@ -461,7 +712,7 @@ class ring_view<RangeType, BoundType>::iterator {
   }
 
   constexpr auto add(difference_type diff) -> iterator&
-    requires std::ranges::random_access_range<parent_base_type>
+    requires detail::ring_random_access_range<parent_base_type>
              && std::signed_integral<difference_type>
   {
     expects_not_empty();
@@ -475,17 +726,17 @@ class ring_view<RangeType, BoundType>::iterator {
     if (diff < to_end) {
       curr_ += diff;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     } else {
-      const auto len = std::ranges::distance(begin_, end_);
+      const auto len = len_.value();
       GSL_ASSUME(len > 0);
 
-      const auto div_mod = std::div(diff - to_end, len);
+      const auto div_mod = len_.div_mod(diff - to_end);
 
       if constexpr (is_bounded_) {
         GSL_ASSUME(div_mod.quot >= 0 && div_mod.quot < std::numeric_limits<difference_type>::max());
 
         constexpr auto bound_max = std::numeric_limits<bound_type>::max();
         const auto pos_diff = static_cast<bound_type>(div_mod.quot) + 1;
-        Expects(pos_ <= bound_max - pos_diff);
+        expects(pos_ <= bound_max - pos_diff);
         pos_ += pos_diff;
       }
 
@@ -496,7 +747,7 @@ class ring_view<RangeType, BoundType>::iterator {
   }
 
   constexpr auto sub(difference_type diff) -> iterator&
-    requires std::ranges::random_access_range<parent_base_type>
+    requires detail::ring_random_access_range<parent_base_type>
              && std::signed_integral<difference_type>
   {
     expects_not_empty();
@@ -512,16 +763,16 @@ class ring_view<RangeType, BoundType>::iterator {
     if (diff < to_rend) {
       curr_ -= diff;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     } else {
-      const auto len = std::ranges::distance(begin_, end_);
+      const auto len = len_.value();
       GSL_ASSUME(len > 0);
 
-      const auto div_mod = std::div(diff - to_rend, len);
+      const auto div_mod = len_.div_mod(diff - to_rend);
 
       if constexpr (is_bounded_) {
         GSL_ASSUME(div_mod.quot >= 0 && div_mod.quot < std::numeric_limits<difference_type>::max());
 
         const auto pos_diff = static_cast<bound_type>(div_mod.quot) + 1;
-        Expects(pos_ >= pos_diff);
+        expects(pos_ >= pos_diff);
         pos_ -= pos_diff;
       }
 
@@ -534,14 +785,14 @@ class ring_view<RangeType, BoundType>::iterator {
 
   [[nodiscard]] constexpr friend auto dist_from_to(const iterator& from_it, const iterator& to_it)
       -> difference_type
-    requires is_bounded_ && std::ranges::random_access_range<parent_base_type>
+    requires is_bounded_ && detail::ring_random_access_range<parent_base_type>
              && std::signed_integral<difference_type>
   {
     GSL_ASSUME(from_it.pos_ >= to_it.pos_);
     GSL_ASSUME(from_it.begin_ == to_it.begin_);
     GSL_ASSUME(from_it.end_ == to_it.end_);
 
-    const auto len = std::ranges::distance(from_it.begin_, to_it.end_);
+    const auto len = from_it.len_.value();
     if (len == 0) {
       return 0;
     }
@@ -555,9 +806,14 @@ class ring_view<RangeType, BoundType>::iterator {
   // -- Contracts
 
   // TODO(compiler): Replace with standard contracts
+  // Checked, or only assumed by unchecked views
+  constexpr static auto expects(bool cond) -> void { detail::ring_expects<ContractPolicy>(cond); }
+
   constexpr static auto expects_same_range(const iterator& lhs, const iterator& rhs) -> void {
-    Expects(lhs.begin_ == rhs.begin_);
-    Expects(lhs.end_ == rhs.end_);
+    expects(lhs.begin_ == rhs.begin_);
+    if constexpr (std::equality_comparable<end_type>) {
+      expects(lhs.end_ == rhs.end_);
+    }
   }
 
   constexpr static auto expects_mult_no_overflow(const difference_type& len,
@@ -565,17 +821,225 @@ class ring_view<RangeType, BoundType>::iterator {
     requires is_bounded_
   {
     GSL_ASSUME(len > 0);
-    Expects(bound <= static_cast<bound_type>(std::numeric_limits<difference_type>::max() / len));
+    expects(bound <= static_cast<bound_type>(std::numeric_limits<difference_type>::max() / len));
   }
 
-  constexpr auto expects_not_empty() const -> void { Expects(curr_ != end_ && begin_ != end_); }
+  constexpr auto expects_not_empty() const -> void { expects(curr_ != end_ && begin_ != end_); }
+
+  // -- Helper functions
+
+  template <class OtherLengthType>
+  [[nodiscard]] constexpr static auto convert_length(const OtherLengthType& len) -> length_type {
+    if constexpr (std::is_convertible_v<OtherLengthType, length_type>) {
+      return len;
+    } else {
+      return len.value() > 0 ? length_type(len.value()) : length_type();
+    }
+  }
+
+  // -- Data members
 
   base_iterator_type curr_ = {};
   base_iterator_type begin_ = {};
-  base_iterator_type end_ = {};
+  [[no_unique_address]] end_type end_ = {};
+  [[no_unique_address]] length_type len_ = {};
   bound_type pos_ = {};
 };
 
+// == ring_view::compact_iterator implementation
+
+// Base begin and the index of the element in the whole ring, lap * extent + offset, so comparison
+// and distance are plain integer ops. The extent is a compile-time constant, so the offset is
+// a multiplication and a shift away and the iterator does not need the view.
+template <std::ranges::forward_range RangeType, ring_view_bound BoundType,
+          ring_view_contract_policy ContractPolicy>
+template <bool Const>
+class ring_view<RangeType, BoundType, ContractPolicy>::compact_iterator {
+  using parent_type =
+      std::conditional_t<Const, std::add_const_t<ring_view<RangeType, BoundType, ContractPolicy>>,
+                         ring_view<RangeType, BoundType, ContractPolicy>>;
+  friend class ring_view<RangeType, BoundType, ContractPolicy>;
+
+  using parent_base_type =
+      std::conditional_t<Const, std::add_const_t<typename parent_type::base_type>,
+                         typename parent_type::base_type>;
+  using bound_type = typename parent_type::bound_type;
+
+ public:
+  // -- Member types
+
+  using base_iterator_type = std::ranges::iterator_t<parent_base_type>;
+
+  using difference_type = std::iter_difference_t<base_iterator_type>;
+  using value_type = std::iter_value_t<base_iterator_type>;
+  using reference = std::iter_reference_t<base_iterator_type>;
+  using pointer = std::add_pointer_t<reference>;
+  using iterator_category = std::random_access_iterator_tag;
+
+  // -- Constructors
+
+  [[nodiscard]] constexpr compact_iterator() noexcept = default;
+
+  [[nodiscard]] constexpr compact_iterator(const compact_iterator&) noexcept = default;
+
+  [[nodiscard]] constexpr compact_iterator(compact_iterator&&) noexcept = default;
+
+  // NOLINTNEXTLINE(google-explicit-constructor,hicpp-explicit-*): Implicit conversion to const
+  [[nodiscard]] constexpr compact_iterator(const compact_iterator<false>& non_const_iter) noexcept
+    requires Const
+      : begin_(non_const_iter.begin_), index_(non_const_iter.index_) {}
+
+  // -- Destructor
+
+  constexpr ~compact_iterator() noexcept = default;
+
+  // -- Assignment
+
+  constexpr auto operator=(const compact_iterator&) noexcept -> compact_iterator& = default;
+
+  constexpr auto operator=(compact_iterator&&) noexcept -> compact_iterator& = default;
+
+  // -- Data access
+
+  [[nodiscard]] constexpr auto operator*() const -> reference { return access(index_); }
+
+  [[nodiscard]] constexpr auto operator->() const -> pointer { return &access(index_); }
+
+  [[nodiscard]] constexpr auto operator[](difference_type diff) const -> reference {
+    return access(index_ + diff);
+  }
+
+  // -- Operations
+
+  constexpr auto operator++() noexcept -> compact_iterator& {
+    ++index_;
+    return *this;
+  }
+
+  constexpr auto operator++(int) noexcept -> compact_iterator {
+    auto iter = *this;
+    ++index_;
+    return iter;
+  }
+
+  constexpr auto operator--() -> compact_iterator& {
+    expects(index_ > 0);
+    --index_;
+    return *this;
+  }
+
+  constexpr auto operator--(int) -> compact_iterator {
+    auto iter = *this;
+    --*this;
+    return iter;
+  }
+
+  constexpr auto operator+=(difference_type diff) -> compact_iterator& {
+    expects(diff >= -index_);
+    index_ += diff;
+    return *this;
+  }
+
+  constexpr auto operator-=(difference_type diff) -> compact_iterator& { return *this += -diff; }
+
+  // -- Non-member operations
+
+  [[nodiscard]] constexpr friend auto operator+(compact_iterator iter, difference_type diff)
+      -> compact_iterator {
+    iter += diff;
+    return iter;
+  }
+
+  [[nodiscard]] constexpr friend auto operator+(difference_type diff, compact_iterator iter)
+      -> compact_iterator {
+    iter += diff;
+    return iter;
+  }
+
+  [[nodiscard]] constexpr friend auto operator-(compact_iterator iter, difference_type diff)
+      -> compact_iterator {
+    iter -= diff;
+    return iter;
+  }
+
+  // Iterators of different views must not be mixed. Like the other contracts this is checked by
+  // default, and ring_view_unchecked assumes it, leaving the ops below single comparisons.
+  [[nodiscard]] constexpr friend auto operator-(const compact_iterator& lhs,
+                                                const compact_iterator& rhs) -> difference_type {
+    expects(lhs.begin_ == rhs.begin_);
+    return lhs.index_ - rhs.index_;
+  }
+
+  // -- Comparison
+
+  [[nodiscard]] constexpr friend auto operator==(const compact_iterator& lhs,
+                                                 const compact_iterator& rhs) -> bool {
+    expects(lhs.begin_ == rhs.begin_);
+    return lhs.index_ == rhs.index_;
+  }
+
+  [[nodiscard]] constexpr friend auto operator<=>(const compact_iterator& lhs,
+                                                  const compact_iterator& rhs)
+      -> std::strong_ordering {
+    expects(lhs.begin_ == rhs.begin_);
+    return lhs.index_ <=> rhs.index_;
+  }
+
+  // -- Segments
+
+  // Same segments as for the generic iterator: one per lap, the first and the last may be partial
+  [[nodiscard]] constexpr friend auto ring_segments(const compact_iterator& first,
+                                                    const compact_iterator& last) {
+    expects(first.begin_ == last.begin_);
+    expects(first.index_ <= last.index_);
+
+    const auto first_lap = first.index_ / extent_;
+    const auto last_lap = last.index_ / extent_;
+    const auto laps_end = last.index_ % extent_ != 0 ? last_lap + 1 : last_lap;
+
+    return std::views::iota(first.index_ != last.index_ ? first_lap : laps_end, laps_end)
+           | std::views::transform([first_lap, first_offset = first.index_ % extent_, last_lap,
+                                    last_offset = last.index_ % extent_,
+                                    begin = first.begin_](difference_type lap) {
+               return std::ranges::subrange<base_iterator_type>(
+                   /* begin */ begin + (lap == first_lap ? first_offset : 0),
+                   /* end   */ begin + (lap == last_lap ? last_offset : extent_));
+             });
+  }
+
+ private:
+  // -- Constants
+
+  constexpr static auto extent_ = static_cast<difference_type>(static_extent_);
+
+  // -- Constructor
+
+  [[nodiscard]] constexpr explicit compact_iterator(base_iterator_type begin,
+                                                    difference_type index = 0) noexcept
+      : begin_(std::move(begin)), index_(index) {}
+
+  // -- Contracts
+
+  constexpr static auto expects(bool cond) -> void { detail::ring_expects<ContractPolicy>(cond); }
+
+  // -- Helper functions
+
+  [[nodiscard]] constexpr auto access(difference_type index) const -> reference {
+    expects(index >= 0);
+    // Unsigned division by a constant is cheaper, and the index is never negative
+    const auto offset = static_cast<std::size_t>(index) % static_extent_;
+    return begin_[static_cast<difference_type>(offset)];
+  }
+
+  // -- Data members
+
+  template <bool>
+  friend class compact_iterator;
+
+  base_iterator_type begin_ = {};
+  difference_type index_ = 0;
+};
+
 // == ring_view deduction guides
 
 template <std::ranges::forward_range RangeType, std::integral BoundType>
@@ -588,6 +1052,47 @@ ring_view(RangeType&&, ring_view_unreachable_bound_t)
 template <std::ranges::forward_range RangeType>
 ring_view(RangeType&&) -> ring_view<std::views::all_t<RangeType>>;
 
+template <ring_view_contract_policy ContractPolicy, std::ranges::forward_range RangeType,
+          std::integral BoundType>
+ring_view(ContractPolicy, RangeType&&, BoundType)
+    -> ring_view<std::views::all_t<RangeType>, ring_view_bound_t, ContractPolicy>;
+
+template <ring_view_contract_policy ContractPolicy, std::ranges::forward_range RangeType>
+ring_view(ContractPolicy, RangeType&&, ring_view_unreachable_bound_t)
+    -> ring_view<std::views::all_t<RangeType>, ring_view_unreachable_bound_t, ContractPolicy>;
+
+template <ring_view_contract_policy ContractPolicy, std::ranges::forward_range RangeType>
+ring_view(ContractPolicy, RangeType&&)
+    -> ring_view<std::views::all_t<RangeType>, ring_view_unreachable_bound_t, ContractPolicy>;
+
+// == ring_view type aliases
+
+// Ring of a trusted pipeline, whose iterator preconditions are assumed instead of checked
+template <std::ranges::forward_range RangeType,
+          ring_view_bound BoundType = ring_view_unreachable_bound_t>
+using ring_view_unchecked = ring_view<RangeType, BoundType, ring_view_assume_contracts_t>;
+
+// == Segments of ring ranges
+
+template <class IterType>
+concept ring_segmented_iterator =
+    std::forward_iterator<IterType> && requires(const IterType& iter) { ring_segments(iter, iter); };
+
+template <class RangeType>
+concept ring_segmented_range = std::ranges::common_range<RangeType>
+                               && ring_segmented_iterator<std::ranges::iterator_t<RangeType>>;
+
+template <ring_segmented_range RangeType>
+  requires std::ranges::borrowed_range<RangeType>
+[[nodiscard]] constexpr auto ring_segments(RangeType&& range) {
+  return ring_segments(std::ranges::begin(range), std::ranges::end(range));
+}
+
+// Base iterator type of the segments of a ring range
+template <ring_segmented_range RangeType>
+using ring_segment_iterator_t = std::ranges::iterator_t<
+    std::ranges::range_value_t<decltype(ring_segments(std::declval<RangeType&>()))>>;
+
 }  // namespace ranges
 
 namespace views {
@@ -625,6 +1130,16 @@ ring(BoundType) -> ring<ranges::ring_view_bound_t>;
 
 // TODO(compiler): Replace GSL_ASSUME with assume attribute
 
-// TODO(improve): borrow, non-common range?, noexcept, reverse unbounded, guarantees
+// TODO(improve): noexcept, reverse unbounded, guarantees
 
 }  // namespace dlgr
+
+// == Borrowed ranges
+
+// Iterators hold copies of the base iterators and of the lap length, not a pointer to the view, so
+// they may outlive it whenever the base iterators may outlive the base
+template <std::ranges::forward_range RangeType, dlgr::ranges::ring_view_bound BoundType,
+          dlgr::ranges::ring_view_contract_policy ContractPolicy>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    dlgr::ranges::ring_view<RangeType, BoundType, ContractPolicy>> =
+    std::ranges::enable_borrowed_range<RangeType>;
@@ -0,0 +1,449 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include <gsl/assert>
+
+#include <dlgr/ring_buffer.h>
+#include <dlgr/ring_view.h>
+
+namespace dlgr {
+
+namespace ranges {
+
+// == Implementation details
+
+namespace detail {
+
+template <class RangeType>
+inline constexpr bool is_unbounded_ring_view_v = false;
+
+template <class RangeType, class ContractPolicy>
+inline constexpr bool
+    is_unbounded_ring_view_v<ring_view<RangeType, ring_view_unreachable_bound_t, ContractPolicy>> =
+        true;
+
+// Unbounded ring_view is only an input range, but its iterators can be copied and walked
+// independently like forward ones, so windows over it are fine
+template <class RangeType>
+concept ring_window_base =
+    std::ranges::forward_range<RangeType>
+    || is_unbounded_ring_view_v<std::remove_cvref_t<RangeType>>;
+
+}  // namespace detail
+
+// == ring_window_view implementation
+
+// Windows of width consecutive elements of the base, each one a counted range of base iterators,
+// so nothing is copied. Both window ends move by one increment per step, which makes a walk over
+// all windows O(n) instead of O(n * width). Works over bounded and unbounded ring_view alike.
+template <std::ranges::view ViewType>
+  requires detail::ring_window_base<ViewType>
+class ring_window_view : public std::ranges::view_interface<ring_window_view<ViewType>> {
+ public:
+  // -- Nested types
+
+  template <bool Const>
+  class iterator;
+
+  template <bool Const>
+  class sentinel;
+
+  // -- Member types
+
+  using base_type = ViewType;
+  using difference_type = std::ranges::range_difference_t<base_type>;
+
+  // -- Constructors
+
+  [[nodiscard]] constexpr ring_window_view()
+    requires std::default_initializable<base_type>
+  = default;
+
+  [[nodiscard]] constexpr ring_window_view(base_type base, difference_type width)
+      : base_(std::move(base)), width_(width) {
+    Expects(width > 0);
+  }
+
+  // -- Range operations
+
+  // Finds the end of the first window, so it is O(width) for non random access bases
+  [[nodiscard]] constexpr auto begin() -> iterator<false> {
+    return make_begin<false>(base_, width_);
+  }
+
+  [[nodiscard]] constexpr auto begin() const -> iterator<true>
+    requires detail::ring_window_base<const base_type>
+  {
+    return make_begin<true>(base_, width_);
+  }
+
+  [[nodiscard]] constexpr auto end() -> sentinel<false> {
+    return sentinel<false>(std::ranges::end(base_));
+  }
+
+  [[nodiscard]] constexpr auto end() const -> sentinel<true>
+    requires detail::ring_window_base<const base_type>
+  {
+    return sentinel<true>(std::ranges::end(base_));
+  }
+
+  [[nodiscard]] constexpr auto size()
+    requires std::ranges::sized_range<base_type>
+  {
+    return windows_count(std::ranges::size(base_));
+  }
+
+  [[nodiscard]] constexpr auto size() const
+    requires std::ranges::sized_range<const base_type>
+  {
+    return windows_count(std::ranges::size(base_));
+  }
+
+  // -- Access
+
+  [[nodiscard]] constexpr auto width() const noexcept -> difference_type { return width_; }
+
+  [[nodiscard]] constexpr auto base() const& -> base_type
+    requires std::copy_constructible<base_type>
+  {
+    return base_;
+  }
+
+  [[nodiscard]] constexpr auto base() && -> base_type { return std::move(base_); }
+
+ private:
+  // -- Helper functions
+
+  template <bool Const, class BaseType>
+  [[nodiscard]] constexpr static auto make_begin(BaseType& base, difference_type width)
+      -> iterator<Const> {
+    auto first = std::ranges::begin(base);
+    auto last = std::ranges::next(first, width - 1, std::ranges::end(base));
+    return iterator<Const>(std::move(first), std::move(last), width);
+  }
+
+  template <class SizeType>
+  [[nodiscard]] constexpr auto windows_count(SizeType base_size) const -> SizeType {
+    const auto width = static_cast<SizeType>(width_);
+    return base_size >= width ? base_size - width + 1 : SizeType{0};
+  }
+
+  // -- Data members
+
+  base_type base_ = {};
+  difference_type width_ = 1;
+};
+
+// == ring_window_view::iterator implementation
+
+template <std::ranges::view ViewType>
+  requires detail::ring_window_base<ViewType>
+template <bool Const>
+class ring_window_view<ViewType>::iterator {
+  friend class ring_window_view<ViewType>;
+
+  using parent_base_type = std::conditional_t<Const, const ViewType, ViewType>;
+
+ public:
+  // -- Member types
+
+  using base_iterator_type = std::ranges::iterator_t<parent_base_type>;
+
+  using difference_type = std::iter_difference_t<base_iterator_type>;
+  using value_type =
+      decltype(std::views::counted(std::declval<base_iterator_type>(), difference_type{}));
+  using iterator_concept =
+      std::conditional_t<std::ranges::forward_range<parent_base_type>, std::forward_iterator_tag,
+                         std::input_iterator_tag>;
+  // Windows are returned by value, so the iterator is only a C++17 input iterator
+  using iterator_category = std::input_iterator_tag;
+
+  // -- Constructors
+
+  [[nodiscard]] constexpr iterator() = default;
+
+  [[nodiscard]] constexpr iterator(const iterator<!Const>& non_const_iter)
+    requires Const
+             && std::convertible_to<std::ranges::iterator_t<ViewType>, base_iterator_type>
+      : first_(non_const_iter.first_),
+        last_(non_const_iter.last_),
+        width_(non_const_iter.width_) {}
+
+  // -- Access
+
+  // Unbounded ring iterators can not be compared, so windows are counted ranges
+  [[nodiscard]] constexpr auto operator*() const -> value_type {
+    return std::views::counted(first_, width_);
+  }
+
+  [[nodiscard]] constexpr auto base() const -> const base_iterator_type& { return first_; }
+
+  // -- Increment
+
+  constexpr auto operator++() -> iterator& {
+    ++first_;
+    ++last_;
+    return *this;
+  }
+
+  constexpr auto operator++(int) -> iterator {
+    auto res = *this;
+    ++*this;
+    return res;
+  }
+
+  // -- Comparison
+
+  [[nodiscard]] constexpr friend auto operator==(const iterator& lhs, const iterator& rhs) -> bool
+    requires std::equality_comparable<base_iterator_type>
+  {
+    return lhs.first_ == rhs.first_;
+  }
+
+ private:
+  // -- Constructors
+
+  [[nodiscard]] constexpr iterator(base_iterator_type first, base_iterator_type last,
+                                   difference_type width)
+      : first_(std::move(first)), last_(std::move(last)), width_(width) {}
+
+  // -- Data members
+
+  template <bool>
+  friend class iterator;
+
+  template <bool>
+  friend class sentinel;
+
+  base_iterator_type first_ = {};
+  // Last element of the window, not the past-the-end one, so the end check is a plain comparison
+  // with the base end
+  base_iterator_type last_ = {};
+  difference_type width_ = 1;
+};
+
+// == ring_window_view::sentinel implementation
+
+template <std::ranges::view ViewType>
+  requires detail::ring_window_base<ViewType>
+template <bool Const>
+class ring_window_view<ViewType>::sentinel {
+  friend class ring_window_view<ViewType>;
+
+  using parent_base_type = std::conditional_t<Const, const ViewType, ViewType>;
+  using base_sentinel_type = std::ranges::sentinel_t<parent_base_type>;
+
+ public:
+  // -- Constructors
+
+  [[nodiscard]] constexpr sentinel() = default;
+
+  // -- Comparison
+
+  [[nodiscard]] constexpr friend auto operator==(const iterator<Const>& iter, const sentinel& sent)
+      -> bool {
+    return sent.is_end(iter);
+  }
+
+ private:
+  // -- Helper functions
+
+  [[nodiscard]] constexpr auto is_end(const iterator<Const>& iter) const -> bool {
+    return iter.last_ == end_;
+  }
+
+  // -- Constructors
+
+  [[nodiscard]] constexpr explicit sentinel(base_sentinel_type end) : end_(std::move(end)) {}
+
+  // -- Data members
+
+  base_sentinel_type end_ = {};
+};
+
+// == ring_window_view deduction guides
+
+template <class RangeType>
+ring_window_view(RangeType&&, std::ranges::range_difference_t<RangeType>)
+    -> ring_window_view<std::views::all_t<RangeType>>;
+
+}  // namespace ranges
+
+namespace views {
+
+// == ring_window implementation
+
+// TODO(compiler): Use range_adaptor_closure
+class ring_window {
+ public:
+  [[nodiscard]] constexpr explicit ring_window(std::ptrdiff_t width) noexcept : width_(width) {}
+
+  template <std::ranges::viewable_range RangeType>
+    requires ranges::detail::ring_window_base<std::views::all_t<RangeType>>
+  [[nodiscard]] constexpr auto operator()(RangeType&& range) const {
+    using difference_type = std::ranges::range_difference_t<RangeType>;
+    return ranges::ring_window_view(std::views::all(std::forward<RangeType>(range)),
+                                    static_cast<difference_type>(width_));
+  }
+
+ private:
+  std::ptrdiff_t width_ = 1;
+};
+
+template <std::ranges::viewable_range RangeType>
+  requires ranges::detail::ring_window_base<std::views::all_t<RangeType>>
+constexpr auto operator|(RangeType&& range, const ring_window& window) {
+  return window(std::forward<RangeType>(range));
+}
+
+}  // namespace views
+
+// == Incremental window aggregates
+
+// Sum of the last width pushed values, updated in O(1) per push
+template <class ValueType>
+  requires std::copyable<ValueType> && requires(ValueType& lhs, const ValueType& rhs) {
+    lhs += rhs;
+    lhs -= rhs;
+  }
+class window_sum {
+ public:
+  // -- Member types
+
+  using value_type = ValueType;
+  using size_type = std::size_t;
+
+  // -- Constructors
+
+  [[nodiscard]] constexpr explicit window_sum(size_type width) : values_(width) {
+    Expects(width > 0);
+  }
+
+  // -- Access
+
+  [[nodiscard]] constexpr auto value() const noexcept -> const value_type& { return sum_; }
+
+  [[nodiscard]] constexpr auto size() const noexcept -> size_type { return values_.size(); }
+
+  [[nodiscard]] constexpr auto width() const noexcept -> size_type { return values_.capacity(); }
+
+  // The first width - 1 results cover only a part of the window
+  [[nodiscard]] constexpr auto full() const noexcept -> bool { return values_.full(); }
+
+  // -- Modification
+
+  constexpr auto push(const value_type& value) -> void {
+    if (values_.full()) {
+      sum_ -= values_.front();
+      values_.pop_front();
+    }
+    sum_ += value;
+    values_.push_back(value);
+  }
+
+  constexpr auto clear() -> void {
+    values_.clear();
+    sum_ = value_type{};
+  }
+
+ private:
+  ring_buffer<value_type> values_;
+  value_type sum_ = {};
+};
+
+// Extremum of the last width pushed values by a monotonic deque: every value is added and dropped
+// at most once, so push is O(1) amortized
+template <class ValueType, class CompareType>
+  requires std::copyable<ValueType>
+           && std::strict_weak_order<CompareType&, const ValueType&, const ValueType&>
+class window_extremum {
+ public:
+  // -- Member types
+
+  using value_type = ValueType;
+  using size_type = std::size_t;
+
+  // -- Constructors
+
+  [[nodiscard]] constexpr explicit window_extremum(size_type width, CompareType comp = {})
+      : candidates_(width), comp_(std::move(comp)) {
+    Expects(width > 0);
+  }
+
+  // -- Access
+
+  [[nodiscard]] constexpr auto value() const -> const value_type& {
+    Expects(!candidates_.empty());
+    return candidates_.front().value;
+  }
+
+  [[nodiscard]] constexpr auto size() const noexcept -> size_type {
+    return std::min(pushed_, width());
+  }
+
+  [[nodiscard]] constexpr auto width() const noexcept -> size_type {
+    return candidates_.capacity();
+  }
+
+  // The first width - 1 results cover only a part of the window
+  [[nodiscard]] constexpr auto full() const noexcept -> bool { return pushed_ >= width(); }
+
+  // -- Modification
+
+  constexpr auto push(const value_type& value) -> void {
+    if (!candidates_.empty() && candidates_.front().index + width() <= pushed_) {
+      candidates_.pop_front();
+    }
+    // Values which are not better than the new one can never become the extremum again
+    while (!candidates_.empty() && !std::invoke(comp_, candidates_.back().value, value)) {
+      candidates_.pop_back();
+    }
+    candidates_.push_back({.index = pushed_, .value = value});
+    ++pushed_;
+  }
+
+  constexpr auto clear() -> void {
+    candidates_.clear();
+    pushed_ = 0;
+  }
+
+ private:
+  // -- Member types
+
+  struct candidate {
+    size_type index = 0;
+    value_type value = {};
+  };
+
+  // -- Data members
+
+  ring_buffer<candidate> candidates_;
+  size_type pushed_ = 0;
+  [[no_unique_address]] CompareType comp_ = {};
+};
+
+template <class ValueType>
+using window_min = window_extremum<ValueType, std::ranges::less>;
+
+template <class ValueType>
+using window_max = window_extremum<ValueType, std::ranges::greater>;
+
+}  // namespace dlgr
+
+// == Borrowed ranges
+
+// Like ring_view, windows hold base iterators only
+template <std::ranges::view ViewType>
+  requires dlgr::ranges::detail::ring_window_base<ViewType>
+inline constexpr bool std::ranges::enable_borrowed_range<dlgr::ranges::ring_window_view<ViewType>> =
+    std::ranges::enable_borrowed_range<ViewType>;
@@ -0,0 +1,563 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#pragma once
+
+#include <array>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <gsl/assert>
+
+#include <dlgr/fast_divisor.h>
+#include <dlgr/ring_view.h>
+
+namespace dlgr {
+
+namespace ranges {
+
+// == Implementation details
+
+namespace detail {
+
+struct ring_zip_unused {};
+
+template <bool Const, class T>
+using ring_zip_maybe_const_t = std::conditional_t<Const, const T, T>;
+
+// Least common multiple of the lengths, zero if any of them is zero
+template <std::integral DifferenceType>
+[[nodiscard]] constexpr auto ring_zip_period(std::span<const DifferenceType> lengths)
+    -> DifferenceType {
+  auto period = DifferenceType{1};
+  for (const auto length : lengths) {
+    if (length == 0) {
+      return 0;
+    }
+    const auto factor = length / std::gcd(period, length);
+    if (period > std::numeric_limits<DifferenceType>::max() / factor) {
+      throw std::overflow_error("period overflow");
+    }
+    period *= factor;
+  }
+  return period;
+}
+
+// Position of a ring_zip_view iterator in one of the bases: the offset into the current lap and,
+// for bases without random access, an iterator to the same element
+template <class RangeType, class DifferenceType>
+class ring_zip_cursor {
+  constexpr static bool is_random_access_ = ring_random_access_range<RangeType>;
+
+ public:
+  // -- Member types
+
+  using base_iterator_type = std::ranges::iterator_t<RangeType>;
+  using difference_type = DifferenceType;
+  using reference = std::ranges::range_reference_t<RangeType>;
+
+  // -- Constructors
+
+  [[nodiscard]] constexpr ring_zip_cursor() = default;
+
+  [[nodiscard]] constexpr ring_zip_cursor(base_iterator_type begin, difference_type length)
+      : begin_(std::move(begin)), length_(length > 0 ? length_type(length) : length_type()) {
+    if constexpr (!is_random_access_) {
+      curr_ = begin_;
+    }
+  }
+
+  template <class OtherRangeType>
+    requires std::convertible_to<std::ranges::iterator_t<OtherRangeType>, base_iterator_type>
+  [[nodiscard]] constexpr explicit ring_zip_cursor(
+      const ring_zip_cursor<OtherRangeType, DifferenceType>& other)
+      : begin_(other.begin_), offset_(other.offset_), length_(other.length_) {
+    if constexpr (!is_random_access_) {
+      curr_ = other.curr_;
+    }
+  }
+
+  // -- Data access
+
+  [[nodiscard]] constexpr auto operator*() const -> reference {
+    if constexpr (is_random_access_) {
+      return begin_[static_cast<std::iter_difference_t<base_iterator_type>>(offset_)];
+    } else {
+      return *curr_;
+    }
+  }
+
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool { return length_.value() == 0; }
+
+  // -- Operations
+
+  constexpr auto next() -> void {
+    ++offset_;
+    if constexpr (!is_random_access_) {
+      ++curr_;
+    }
+    if (offset_ == length_.value()) {
+      offset_ = 0;
+      if constexpr (!is_random_access_) {
+        curr_ = begin_;
+      }
+    }
+  }
+
+  constexpr auto prev() -> void
+    requires is_random_access_
+  {
+    if (offset_ == 0) {
+      offset_ = length_.value();
+    }
+    --offset_;
+  }
+
+  // One modular reduction, plus a walk of less than a lap for bases without random access
+  constexpr auto seek(difference_type pos) -> void {
+    offset_ = length_.mod(pos);
+    if constexpr (!is_random_access_) {
+      curr_ = std::ranges::next(begin_, static_cast<std::iter_difference_t<base_iterator_type>>(
+                                            offset_));
+    }
+  }
+
+ private:
+  // -- Member types
+
+  using length_type = fast_divisor<difference_type>;
+  using cursor_type = std::conditional_t<is_random_access_, ring_zip_unused, base_iterator_type>;
+
+  // -- Data members
+
+  template <class, class>
+  friend class ring_zip_cursor;
+
+  base_iterator_type begin_ = {};
+  [[no_unique_address]] cursor_type curr_ = {};
+  difference_type offset_ = 0;
+  length_type length_ = {};
+};
+
+}  // namespace detail
+
+// == ring_zip_view implementation
+
+// Tuples of the elements of several bases repeated endlessly (or bound periods long) side by side,
+// where the combined period is the least common multiple of the base sizes. An iterator counts the
+// steps taken and keeps an offset per base which wraps by a comparison, and a seek to any step is
+// one modular reduction per base by a precomputed divisor. Over random access bases the iterator
+// has random access, other forward bases walk less than a lap per base on a seek.
+template <ring_view_bound BoundType, std::ranges::view... ViewTypes>
+  requires(sizeof...(ViewTypes) > 0 && (std::ranges::forward_range<ViewTypes> && ...))
+class ring_zip_view : public std::ranges::view_interface<ring_zip_view<BoundType, ViewTypes...>> {
+  constexpr static bool is_bounded_ = std::is_same_v<BoundType, ring_view_bound_t>;
+
+  constexpr static bool is_const_iterable_ = (std::ranges::forward_range<const ViewTypes> && ...);
+
+ public:
+  // -- Nested types
+
+  template <bool Const>
+  class iterator;
+
+  // Reached only when a base is empty, the unbounded view is endless otherwise
+  class unreachable_sentinel {};
+
+  // -- Member types
+
+  using bound_type = BoundType;
+  using difference_type = std::common_type_t<std::ranges::range_difference_t<ViewTypes>...>;
+
+  // -- Constructors
+
+  [[nodiscard]] constexpr ring_zip_view()
+    requires(std::default_initializable<ViewTypes> && ...)
+  = default;
+
+  [[nodiscard]] constexpr explicit ring_zip_view(ViewTypes... bases)
+    requires(!is_bounded_)
+      : bases_(std::move(bases)...) {}
+
+  [[nodiscard]] constexpr explicit ring_zip_view(bound_type bound, ViewTypes... bases)
+      : bases_(std::move(bases)...), bound_{bound} {
+    validate();
+  }
+
+  // -- Range operations
+
+  [[nodiscard]] constexpr auto begin() -> iterator<false> { return iterator_at(0); }
+
+  [[nodiscard]] constexpr auto begin() const -> iterator<true>
+    requires is_const_iterable_
+  {
+    return iterator_at(0);
+  }
+
+  // O(n) for bases without size(), like ring_view::end()
+  [[nodiscard]] constexpr auto end() -> iterator<false>
+    requires is_bounded_
+  {
+    return make_iterator<false>(bases_, std::nullopt);
+  }
+
+  [[nodiscard]] constexpr auto end() const -> iterator<true>
+    requires is_bounded_ && is_const_iterable_
+  {
+    return make_iterator<true>(bases_, std::nullopt);
+  }
+
+  [[nodiscard]] constexpr auto end() const noexcept -> unreachable_sentinel
+    requires(!is_bounded_)
+  {
+    return {};
+  }
+
+  [[nodiscard]] constexpr auto size() const -> std::size_t
+    requires is_bounded_ && (std::ranges::sized_range<const ViewTypes> && ...)
+  {
+    return bound_ * static_cast<std::size_t>(period());
+  }
+
+  // -- Seeking
+
+  // Iterator after step steps, found without walking the steps before it
+  [[nodiscard]] constexpr auto iterator_at(difference_type step) -> iterator<false> {
+    return make_iterator<false>(bases_, step);
+  }
+
+  [[nodiscard]] constexpr auto iterator_at(difference_type step) const -> iterator<true>
+    requires is_const_iterable_
+  {
+    return make_iterator<true>(bases_, step);
+  }
+
+  // -- Access
+
+  [[nodiscard]] constexpr auto bound() const noexcept -> bound_type { return bound_; }
+
+  // Number of steps after which the tuples repeat, zero if any base is empty
+  [[nodiscard]] constexpr auto period() const -> difference_type
+    requires(std::ranges::sized_range<const ViewTypes> && ...)
+  {
+    return std::apply(
+        [](const auto&... bases) {
+          const auto lengths =
+              std::array{static_cast<difference_type>(std::ranges::size(bases))...};
+          return detail::ring_zip_period<difference_type>(lengths);
+        },
+        bases_);
+  }
+
+  [[nodiscard]] constexpr auto bases() const& -> std::tuple<ViewTypes...>
+    requires(std::copy_constructible<ViewTypes> && ...)
+  {
+    return bases_;
+  }
+
+  [[nodiscard]] constexpr auto bases() && -> std::tuple<ViewTypes...> {
+    return std::move(bases_);
+  }
+
+ private:
+  // -- Helper functions
+
+  constexpr auto validate() const -> void {
+    if constexpr (is_bounded_ && (std::ranges::sized_range<const ViewTypes> && ...)) {
+      const auto length = static_cast<std::size_t>(period());
+      constexpr auto max_size = std::numeric_limits<std::size_t>::max();
+      if (length != 0 && bound_ > max_size / length) {
+        throw std::overflow_error("bound overflow");
+      }
+    }
+  }
+
+  // The bases may change their sizes after construction, so the lengths are found anew every
+  // time. No step means the end of the bounded view.
+  template <bool Const, class BasesType>
+  [[nodiscard]] constexpr auto make_iterator(BasesType& bases,
+                                             std::optional<difference_type> step) const
+      -> iterator<Const> {
+    using iterator_type = iterator<Const>;
+    using cursors_type = typename iterator_type::cursors_type;
+
+    return [&]<std::size_t... Index>(std::index_sequence<Index...>) {
+      const auto lengths = std::array{
+          static_cast<difference_type>(std::ranges::distance(std::get<Index>(bases)))...};
+      const auto period = detail::ring_zip_period<difference_type>(lengths);
+
+      auto pos = difference_type{0};
+      if (step) {
+        Expects(*step >= 0);
+        pos = *step;
+      } else if constexpr (is_bounded_) {
+        pos = static_cast<difference_type>(bound_) * period;
+      }
+
+      auto iter = iterator_type(cursors_type(std::tuple_element_t<Index, cursors_type>(
+                                    std::ranges::begin(std::get<Index>(bases)), lengths[Index])...),
+                                pos);
+      if (period > 0 && pos > 0) {
+        iter.seek(pos);
+      }
+      return iter;
+    }(std::index_sequence_for<ViewTypes...>{});
+  }
+
+  // -- Data members
+
+  std::tuple<ViewTypes...> bases_ = {};
+  bound_type bound_ = {};
+};
+
+// == ring_zip_view::iterator implementation
+
+template <ring_view_bound BoundType, std::ranges::view... ViewTypes>
+  requires(sizeof...(ViewTypes) > 0 && (std::ranges::forward_range<ViewTypes> && ...))
+template <bool Const>
+class ring_zip_view<BoundType, ViewTypes...>::iterator {
+  friend class ring_zip_view<BoundType, ViewTypes...>;
+
+  constexpr static bool is_random_access_ =
+      (detail::ring_random_access_range<detail::ring_zip_maybe_const_t<Const, ViewTypes>> && ...);
+
+ public:
+  // -- Member types
+
+  using difference_type = std::common_type_t<std::ranges::range_difference_t<ViewTypes>...>;
+  using value_type =
+      std::tuple<std::ranges::range_value_t<detail::ring_zip_maybe_const_t<Const, ViewTypes>>...>;
+  using reference = std::tuple<
+      std::ranges::range_reference_t<detail::ring_zip_maybe_const_t<Const, ViewTypes>>...>;
+  using iterator_concept = std::conditional_t<is_random_access_, std::random_access_iterator_tag,
+                                              std::forward_iterator_tag>;
+  // Tuples are made on the fly, so the iterator is no more than an input one for legacy code
+  using iterator_category = std::input_iterator_tag;
+
+  // -- Constructors
+
+  [[nodiscard]] constexpr iterator() = default;
+
+  [[nodiscard]] constexpr iterator(const iterator<!Const>& non_const_iter)
+    requires Const
+             && (std::convertible_to<std::ranges::iterator_t<ViewTypes>,
+                                     std::ranges::iterator_t<const ViewTypes>>
+                 && ...)
+      : cursors_(non_const_iter.cursors_), pos_(non_const_iter.pos_) {}
+
+  // -- Data access
+
+  [[nodiscard]] constexpr auto operator*() const -> reference {
+    return std::apply([](const auto&... cursor) { return reference(*cursor...); }, cursors_);
+  }
+
+  [[nodiscard]] constexpr auto operator[](difference_type diff) const -> reference
+    requires is_random_access_
+  {
+    return *(*this + diff);
+  }
+
+  // Number of steps from the beginning of the view
+  [[nodiscard]] constexpr auto step() const noexcept -> difference_type { return pos_; }
+
+  // -- Operations
+
+  constexpr auto operator++() -> iterator& {
+    ++pos_;
+    std::apply([](auto&... cursor) { (cursor.next(), ...); }, cursors_);
+    return *this;
+  }
+
+  constexpr auto operator++(int) -> iterator {
+    auto iter = *this;
+    ++*this;
+    return iter;
+  }
+
+  constexpr auto operator--() -> iterator&
+    requires is_random_access_
+  {
+    --pos_;
+    std::apply([](auto&... cursor) { (cursor.prev(), ...); }, cursors_);
+    return *this;
+  }
+
+  constexpr auto operator--(int) -> iterator
+    requires is_random_access_
+  {
+    auto iter = *this;
+    --*this;
+    return iter;
+  }
+
+  // Offsets are found from the step itself, so a jump costs the same however far it goes
+  constexpr auto operator+=(difference_type diff) -> iterator&
+    requires is_random_access_
+  {
+    pos_ += diff;
+    seek(pos_);
+    return *this;
+  }
+
+  constexpr auto operator-=(difference_type diff) -> iterator&
+    requires is_random_access_
+  {
+    return *this += -diff;
+  }
+
+  // -- Non-member operations
+
+  [[nodiscard]] constexpr friend auto operator+(iterator iter, difference_type diff) -> iterator
+    requires is_random_access_
+  {
+    iter += diff;
+    return iter;
+  }
+
+  [[nodiscard]] constexpr friend auto operator+(difference_type diff, iterator iter) -> iterator
+    requires is_random_access_
+  {
+    iter += diff;
+    return iter;
+  }
+
+  [[nodiscard]] constexpr friend auto operator-(iterator iter, difference_type diff) -> iterator
+    requires is_random_access_
+  {
+    iter -= diff;
+    return iter;
+  }
+
+  [[nodiscard]] constexpr friend auto operator-(const iterator& lhs, const iterator& rhs)
+      -> difference_type
+    requires is_random_access_
+  {
+    return lhs.pos_ - rhs.pos_;
+  }
+
+  // -- Comparison
+
+  // Iterators of one view differ only in the number of steps taken
+  [[nodiscard]] constexpr friend auto operator==(const iterator& lhs, const iterator& rhs) -> bool {
+    return lhs.pos_ == rhs.pos_;
+  }
+
+  [[nodiscard]] constexpr friend auto operator<=>(const iterator& lhs, const iterator& rhs)
+      -> std::strong_ordering {
+    return lhs.pos_ <=> rhs.pos_;
+  }
+
+  // -- Sentinel equality comparison
+
+  [[nodiscard]] constexpr auto operator==(
+      [[maybe_unused]] const unreachable_sentinel& sen) const noexcept -> bool
+    requires(!is_bounded_)
+  {
+    return std::apply([](const auto&... cursor) { return (cursor.empty() || ...); }, cursors_);
+  }
+
+  [[nodiscard]] constexpr friend auto operator==(const unreachable_sentinel& sen,
+                                                 const iterator& iter) noexcept -> bool
+    requires(!is_bounded_)
+  {
+    return iter == sen;
+  }
+
+ private:
+  // -- Member types
+
+  template <class ViewType>
+  using cursor_type =
+      detail::ring_zip_cursor<detail::ring_zip_maybe_const_t<Const, ViewType>, difference_type>;
+
+  using cursors_type = std::tuple<cursor_type<ViewTypes>...>;
+
+  // -- Constructors
+
+  [[nodiscard]] constexpr iterator(cursors_type cursors, difference_type pos)
+      : cursors_(std::move(cursors)), pos_(pos) {}
+
+  // -- Helper functions
+
+  constexpr auto seek(difference_type pos) -> void {
+    Expects(pos >= 0);
+    std::apply([pos](auto&... cursor) { (cursor.seek(pos), ...); }, cursors_);
+  }
+
+  // -- Data members
+
+  template <bool>
+  friend class iterator;
+
+  cursors_type cursors_ = {};
+  difference_type pos_ = 0;
+};
+
+// == ring_zip_view deduction guides
+
+template <std::integral BoundType, std::ranges::viewable_range... RangeTypes>
+ring_zip_view(BoundType, RangeTypes&&...)
+    -> ring_zip_view<ring_view_bound_t, std::views::all_t<RangeTypes>...>;
+
+template <std::ranges::viewable_range... RangeTypes>
+ring_zip_view(ring_view_unreachable_bound_t, RangeTypes&&...)
+    -> ring_zip_view<ring_view_unreachable_bound_t, std::views::all_t<RangeTypes>...>;
+
+template <std::ranges::viewable_range... RangeTypes>
+ring_zip_view(RangeTypes&&...)
+    -> ring_zip_view<ring_view_unreachable_bound_t, std::views::all_t<RangeTypes>...>;
+
+// == Implementation details
+
+namespace detail {
+
+class ring_zip_fn {
+ public:
+  template <std::ranges::viewable_range... RangeTypes>
+    requires(sizeof...(RangeTypes) > 0
+             && (std::ranges::forward_range<std::views::all_t<RangeTypes>> && ...))
+  [[nodiscard]] constexpr auto operator()(RangeTypes&&... ranges) const {
+    return ring_zip_view(std::views::all(std::forward<RangeTypes>(ranges))...);
+  }
+
+  // Stops after bound combined periods
+  template <std::ranges::viewable_range... RangeTypes>
+    requires(sizeof...(RangeTypes) > 0
+             && (std::ranges::forward_range<std::views::all_t<RangeTypes>> && ...))
+  [[nodiscard]] constexpr auto operator()(ring_view_bound_t bound, RangeTypes&&... ranges) const {
+    return ring_zip_view(bound, std::views::all(std::forward<RangeTypes>(ranges))...);
+  }
+};
+
+}  // namespace detail
+
+}  // namespace ranges
+
+namespace views {
+
+// == ring_zip implementation
+
+constexpr inline ranges::detail::ring_zip_fn ring_zip = {};
+
+}  // namespace views
+
+}  // namespace dlgr
+
+// == Borrowed ranges
+
+// Iterators hold base iterators and offsets only
+template <dlgr::ranges::ring_view_bound BoundType, std::ranges::view... ViewTypes>
+  requires(sizeof...(ViewTypes) > 0 && (std::ranges::forward_range<ViewTypes> && ...))
+inline constexpr bool
+    std::ranges::enable_borrowed_range<dlgr::ranges::ring_zip_view<BoundType, ViewTypes...>> =
+        (std::ranges::enable_borrowed_range<ViewTypes> && ...);
@@ -0,0 +1,267 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <gsl/assert>
+
+#include <dlgr/cache_line.h>
+
+namespace dlgr {
+
+// == Implementation details
+
+namespace detail {
+
+// Log-linear bins in the manner of HdrHistogram: values below 2^PrecisionBits get a bin each, and
+// every further power of two is split into 2^PrecisionBits bins of equal width, so a bin is never
+// wider than 2^-PrecisionBits of the values in it. Values of ValueBits bits or more share the last
+// bin.
+template <std::size_t PrecisionBits, std::size_t ValueBits>
+struct log_linear_bins {
+  static_assert(PrecisionBits > 0 && PrecisionBits < ValueBits && ValueBits <= 64);
+
+  using value_type = std::uint64_t;
+
+  constexpr static auto sub_bins = std::size_t{1} << PrecisionBits;
+  constexpr static auto count = (ValueBits - PrecisionBits + 1) * sub_bins;
+
+  [[nodiscard]] constexpr static auto index_of(value_type value) noexcept -> std::size_t {
+    if (value < sub_bins) {
+      return static_cast<std::size_t>(value);
+    }
+    const auto shift = static_cast<std::size_t>(std::bit_width(value)) - PrecisionBits - 1;
+    const auto index = (shift + 1) * sub_bins + static_cast<std::size_t>(value >> shift) - sub_bins;
+    return std::min(index, count - 1);
+  }
+
+  // Largest value which falls into the bin
+  [[nodiscard]] constexpr static auto highest_of(std::size_t index) noexcept -> value_type {
+    if (index < sub_bins) {
+      return index;
+    }
+    const auto shift = index / sub_bins - 1;
+    const auto lowest = value_type{sub_bins + index % sub_bins} << shift;
+    return lowest + (value_type{1} << shift) - 1;
+  }
+};
+
+}  // namespace detail
+
+// == rolling_histogram implementation
+
+// Distribution of the values recorded over the last buckets_count periods of bucket_duration,
+// e.g. latencies over the last minute in one-second buckets. Every bucket is a fixed array of
+// log-linear bins, so a quantile is a walk over the bins and nothing is sorted.
+//
+// record() is one relaxed fetch_add on the bin of the current bucket and may be called from any
+// number of threads. Everything else is for one reporting thread: it moves the window with
+// advance() (or rotate() one period at a time) and asks for quantiles. The reporter keeps a sum of
+// the closed buckets, so expiring the oldest one subtracts its bins and a quantile sums at most two
+// live buckets on top. A closed bucket gets one more period before it is added to the sum, which
+// is the grace given to a record() that started before the rotation.
+template <std::size_t PrecisionBits = 7, std::size_t ValueBits = 40>
+class rolling_histogram {
+  using bins = detail::log_linear_bins<PrecisionBits, ValueBits>;
+
+ public:
+  // -- Member types
+
+  using value_type = std::uint64_t;
+  using count_type = std::uint64_t;
+  using size_type = std::size_t;
+  using clock_type = std::chrono::steady_clock;
+  using duration_type = clock_type::duration;
+  using time_point_type = clock_type::time_point;
+
+  // -- Constants
+
+  constexpr static auto bins_count = bins::count;
+
+  // Upper bound of (reported - exact) / exact for values below 2^ValueBits
+  constexpr static auto relative_error = 1.0 / static_cast<double>(bins::sub_bins);
+
+  // -- Constructors
+
+  [[nodiscard]] rolling_histogram(duration_type bucket_duration, size_type buckets_count,
+                                  time_point_type now = clock_type::now())
+      : counts_(buckets_count * bins_count),
+        sealed_(bins_count, 0),
+        buckets_count_(buckets_count),
+        bucket_duration_(bucket_duration),
+        bucket_end_(now + bucket_duration) {
+    Expects(buckets_count >= 2);
+    Expects(bucket_duration > duration_type::zero());
+  }
+
+  rolling_histogram(const rolling_histogram&) = delete;
+  rolling_histogram(rolling_histogram&&) = delete;
+
+  // -- Destructor
+
+  ~rolling_histogram() noexcept = default;
+
+  // -- Assignment
+
+  auto operator=(const rolling_histogram&) -> rolling_histogram& = delete;
+  auto operator=(rolling_histogram&&) -> rolling_histogram& = delete;
+
+  // -- Recording
+
+  auto record(value_type value, count_type count = 1) noexcept -> void {
+    const auto bucket = current_.load(std::memory_order::acquire);
+    bucket_bins(bucket)[bins::index_of(value)].fetch_add(count, std::memory_order::relaxed);
+  }
+
+  // -- Window
+
+  // Rotates once per bucket_duration passed since the last call
+  auto advance(time_point_type now = clock_type::now()) -> void {
+    if (now < bucket_end_) {
+      return;
+    }
+
+    // Past a whole window all buckets are stale, so there is no point rotating more times
+    const auto periods = static_cast<size_type>((now - bucket_end_) / bucket_duration_) + 1;
+    for (auto period = size_type{0}; period < std::min(periods, buckets_count_); ++period) {
+      rotate();
+    }
+    bucket_end_ += bucket_duration_ * static_cast<duration_type::rep>(periods);
+  }
+
+  // Closes the current bucket and reuses the oldest one as the new current bucket
+  auto rotate() noexcept -> void {
+    const auto current = current_.load(std::memory_order::relaxed);
+    const auto next = (current + 1) % buckets_count_;
+
+    // With two buckets the closed one expires before it is ever sealed
+    if (unsealed_ != buckets_count_ && unsealed_ != next) {
+      add_bins(bucket_bins(unsealed_));
+      ++sealed_count_;
+    }
+    if (sealed_count_ + 1 == buckets_count_) {
+      subtract_bins(bucket_bins(next));
+      --sealed_count_;
+    }
+
+    for (auto& bin : bucket_bins(next)) {
+      bin.store(0, std::memory_order::relaxed);
+    }
+    unsealed_ = current;
+    current_.store(next, std::memory_order::release);
+  }
+
+  // -- Queries
+
+  // Number of values in the window
+  [[nodiscard]] auto count() const noexcept -> count_type {
+    const auto current = current_.load(std::memory_order::relaxed);
+    auto total = count_type{0};
+    for (auto index = size_type{0}; index < bins_count; ++index) {
+      total += bin_count(index, current);
+    }
+    return total;
+  }
+
+  // Smallest bin bound v such that at least the given fraction of the values is not greater than
+  // v, 0 for an empty window
+  [[nodiscard]] auto quantile(double fraction) const noexcept -> value_type {
+    auto value = value_type{0};
+    quantiles(std::span(&fraction, 1), std::span(&value, 1));
+    return value;
+  }
+
+  // Same as quantile() for every fraction, sorted ascending, in one walk over the bins
+  auto quantiles(std::span<const double> fractions, std::span<value_type> out) const noexcept
+      -> void {
+    Expects(fractions.size() == out.size());
+    Expects(std::ranges::is_sorted(fractions));
+
+    const auto total = count();
+    if (total == 0) {
+      std::ranges::fill(out, 0);
+      return;
+    }
+
+    const auto current = current_.load(std::memory_order::relaxed);
+    auto next = size_type{0};
+    auto seen = count_type{0};
+    for (auto index = size_type{0}; index < bins_count && next < fractions.size(); ++index) {
+      seen += bin_count(index, current);
+      while (next < fractions.size() && seen >= rank_of(fractions[next], total)) {
+        out[next++] = bins::highest_of(index);
+      }
+    }
+  }
+
+ private:
+  // -- Helper functions
+
+  [[nodiscard]] auto bucket_bins(size_type bucket) noexcept
+      -> std::span<std::atomic<count_type>, bins_count> {
+    return std::span<std::atomic<count_type>, bins_count>(counts_.data() + bucket * bins_count,
+                                                          bins_count);
+  }
+
+  [[nodiscard]] auto bucket_bins(size_type bucket) const noexcept
+      -> std::span<const std::atomic<count_type>, bins_count> {
+    return std::span<const std::atomic<count_type>, bins_count>(
+        counts_.data() + bucket * bins_count, bins_count);
+  }
+
+  // Sealed sum plus the buckets not in it yet
+  [[nodiscard]] auto bin_count(size_type index, size_type current) const noexcept -> count_type {
+    auto total = sealed_[index] + bucket_bins(current)[index].load(std::memory_order::relaxed);
+    if (unsealed_ != buckets_count_) {
+      total += bucket_bins(unsealed_)[index].load(std::memory_order::relaxed);
+    }
+    return total;
+  }
+
+  auto add_bins(std::span<const std::atomic<count_type>, bins_count> bucket) noexcept -> void {
+    for (auto index = size_type{0}; index < bins_count; ++index) {
+      sealed_[index] += bucket[index].load(std::memory_order::relaxed);
+    }
+  }
+
+  // Never below zero, even if a very late record() went into the bucket after it was sealed
+  auto subtract_bins(std::span<const std::atomic<count_type>, bins_count> bucket) noexcept
+      -> void {
+    for (auto index = size_type{0}; index < bins_count; ++index) {
+      sealed_[index] -= std::min(sealed_[index], bucket[index].load(std::memory_order::relaxed));
+    }
+  }
+
+  // 1-based rank of the quantile, at least the first value
+  [[nodiscard]] static auto rank_of(double fraction, count_type total) noexcept -> count_type {
+    const auto rank = std::ceil(std::clamp(fraction, 0.0, 1.0) * static_cast<double>(total));
+    return std::max(static_cast<count_type>(rank), count_type{1});
+  }
+
+  // -- Data members
+
+  // Buckets one after another, bins_count counters each
+  std::vector<std::atomic<count_type>> counts_;
+
+  // Reporter side: the sum of the sealed buckets, and the closed bucket not in it yet
+  // (buckets_count_ if there is none)
+  std::vector<count_type> sealed_;
+  size_type buckets_count_ = 0;
+  size_type unsealed_ = buckets_count_;
+  size_type sealed_count_ = 0;
+  duration_type bucket_duration_ = {};
+  time_point_type bucket_end_ = {};
+
+  alignas(cache_line_size) std::atomic<size_type> current_ = 0;
+};
+
+}  // namespace dlgr
@@ -0,0 +1,241 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <gsl/assert>
+
+#include <dlgr/cache_line.h>
+#include <dlgr/fast_divisor.h>
+#include <dlgr/ring_view.h>
+
+namespace dlgr {
+
+// == Implementation details
+
+namespace detail {
+
+template <class ViewType>
+concept round_robin_base =
+    std::ranges::view<ViewType> && std::ranges::random_access_range<const ViewType>
+    && std::ranges::sized_range<const ViewType>;
+
+}  // namespace detail
+
+// == round_robin implementation
+
+// Hands out the elements of a non-empty base in turn to any number of threads. A call is one
+// relaxed fetch_add on a counter which has a cache line of its own, and the ticket is turned into
+// an index by a precomputed divisor, so there is neither a lock nor a hardware division. The base
+// must not change while the dispenser is in use.
+//
+// Tickets wrap around after 2^64 calls, which breaks the order once unless the size is a power of
+// two.
+template <detail::round_robin_base ViewType>
+class round_robin {
+ public:
+  // -- Member types
+
+  using base_type = ViewType;
+  using size_type = std::size_t;
+  using reference = std::ranges::range_reference_t<const base_type>;
+
+  // -- Constructors
+
+  [[nodiscard]] explicit round_robin(base_type base)
+      : base_(std::move(base)),
+        ring_(std::ranges::ref_view<const base_type>(base_)),
+        divisor_(checked_size(base_)) {}
+
+  round_robin(const round_robin&) = delete;
+  round_robin(round_robin&&) = delete;
+
+  // -- Destructor
+
+  ~round_robin() noexcept = default;
+
+  // -- Assignment
+
+  auto operator=(const round_robin&) -> round_robin& = delete;
+  auto operator=(round_robin&&) -> round_robin& = delete;
+
+  // -- Dispensing
+
+  [[nodiscard]] auto next() noexcept -> reference {
+    const auto ticket = counter_.value.fetch_add(1, std::memory_order::relaxed);
+    return std::ranges::begin(base_)[static_cast<difference_type>(divisor_.mod(ticket))];
+  }
+
+  // Reserves count consecutive turns with one fetch_add and returns their elements, which wrap
+  // around the end of the base like the ones of ring_view
+  [[nodiscard]] auto next_batch(size_type count) noexcept {
+    const auto ticket = counter_.value.fetch_add(count, std::memory_order::relaxed);
+    const auto offset = static_cast<difference_type>(divisor_.mod(ticket));
+    return std::views::counted(ring_.begin() + offset, static_cast<difference_type>(count));
+  }
+
+  // -- Access
+
+  [[nodiscard]] auto size() const noexcept -> size_type { return divisor_.value(); }
+
+  [[nodiscard]] auto base() const noexcept -> const base_type& { return base_; }
+
+  // Number of turns taken so far, only a snapshot while other threads are running
+  [[nodiscard]] auto turns() const noexcept -> size_type {
+    return counter_.value.load(std::memory_order::relaxed);
+  }
+
+ private:
+  // -- Member types
+
+  using difference_type = std::ranges::range_difference_t<const base_type>;
+  using ring_type = ranges::ring_view<std::ranges::ref_view<const base_type>>;
+
+  struct alignas(cache_line_size) padded_counter {
+    std::atomic<size_type> value = 0;
+  };
+
+  // -- Helper functions
+
+  [[nodiscard]] static auto checked_size(const base_type& base) -> size_type {
+    const auto size = static_cast<size_type>(std::ranges::size(base));
+    Expects(size > 0);
+    return size;
+  }
+
+  // -- Data members
+
+  // base_, ring_ and divisor_ are only read once constructed, so they may share a line, while the
+  // counter every call increments is padded away from them
+  base_type base_;
+  ring_type ring_;
+  fast_divisor<size_type> divisor_;
+
+  padded_counter counter_ = {};
+};
+
+// == round_robin deduction guides
+
+template <class RangeType>
+round_robin(RangeType&&) -> round_robin<std::views::all_t<RangeType>>;
+
+// == weighted_round_robin implementation
+
+// Round robin where element i gets weights[i] turns out of every sum(weights) / gcd(weights).
+// The turns are laid out once by smooth weighted round robin (the nginx one), which spreads the
+// turns of every element evenly over the period, and then handed out by a round_robin over that
+// schedule. The schedule takes O(period * size) to build and O(period) memory.
+template <detail::round_robin_base ViewType>
+class weighted_round_robin {
+ public:
+  // -- Member types
+
+  using base_type = ViewType;
+  using size_type = std::size_t;
+  using reference = std::ranges::range_reference_t<const base_type>;
+
+  // -- Constructors
+
+  [[nodiscard]] weighted_round_robin(base_type base, std::span<const size_type> weights)
+      : base_(std::move(base)),
+        schedule_(std::ranges::owning_view(make_schedule(base_, weights))) {}
+
+  weighted_round_robin(const weighted_round_robin&) = delete;
+  weighted_round_robin(weighted_round_robin&&) = delete;
+
+  // -- Destructor
+
+  ~weighted_round_robin() noexcept = default;
+
+  // -- Assignment
+
+  auto operator=(const weighted_round_robin&) -> weighted_round_robin& = delete;
+  auto operator=(weighted_round_robin&&) -> weighted_round_robin& = delete;
+
+  // -- Dispensing
+
+  [[nodiscard]] auto next() noexcept -> reference { return element(schedule_.next()); }
+
+  [[nodiscard]] auto next_batch(size_type count) noexcept {
+    auto to_element = [this](size_type index) -> reference { return element(index); };
+    return schedule_.next_batch(count) | std::views::transform(to_element);
+  }
+
+  // -- Access
+
+  // Number of turns after which the schedule repeats
+  [[nodiscard]] auto period() const noexcept -> size_type { return schedule_.size(); }
+
+  // Indices of the base elements in the order they are handed out
+  [[nodiscard]] auto schedule() const noexcept -> std::span<const size_type> {
+    return schedule_.base();
+  }
+
+  [[nodiscard]] auto base() const noexcept -> const base_type& { return base_; }
+
+ private:
+  // -- Member types
+
+  using difference_type = std::ranges::range_difference_t<const base_type>;
+  using schedule_type = std::ranges::owning_view<std::vector<size_type>>;
+
+  // -- Helper functions
+
+  [[nodiscard]] static auto make_schedule(const base_type& base,
+                                          std::span<const size_type> weights)
+      -> std::vector<size_type> {
+    Expects(weights.size() == static_cast<size_type>(std::ranges::size(base)));
+
+    const auto divisor =
+        std::accumulate(weights.begin(), weights.end(), size_type{0},
+                        [](size_type lhs, size_type rhs) { return std::gcd(lhs, rhs); });
+    Expects(divisor > 0);
+
+    auto reduced = std::vector<size_type>(weights.begin(), weights.end());
+    for (auto& weight : reduced) {
+      weight /= divisor;
+    }
+    const auto period = std::accumulate(reduced.begin(), reduced.end(), size_type{0});
+
+    // Every turn all elements gain their weight, and the one ahead of the others is picked and
+    // set back by the total weight
+    auto current = std::vector<std::ptrdiff_t>(reduced.size());
+    auto schedule = std::vector<size_type>();
+    schedule.reserve(period);
+    for (auto turn = size_type{0}; turn < period; ++turn) {
+      for (auto index = size_type{0}; index < reduced.size(); ++index) {
+        current[index] += static_cast<std::ptrdiff_t>(reduced[index]);
+      }
+      const auto best = std::ranges::max_element(current);
+      *best -= static_cast<std::ptrdiff_t>(period);
+      schedule.push_back(static_cast<size_type>(best - current.begin()));
+    }
+    return schedule;
+  }
+
+  [[nodiscard]] auto element(size_type index) const noexcept -> reference {
+    return std::ranges::begin(base_)[static_cast<difference_type>(index)];
+  }
+
+  // -- Data members
+
+  base_type base_;
+  round_robin<schedule_type> schedule_;
+};
+
+// == weighted_round_robin deduction guides
+
+template <class RangeType>
+weighted_round_robin(RangeType&&, std::span<const std::size_t>)
+    -> weighted_round_robin<std::views::all_t<RangeType>>;
+
+}  // namespace dlgr
@@ -0,0 +1,460 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#pragma once
+
+#if !defined(__linux__)
+#error "dlgr/shm_ring.h requires Linux (futex, memfd_create)"
+#endif
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <gsl/assert>
+
+#include <dlgr/cache_line.h>
+
+namespace dlgr {
+
+// == Implementation details
+
+namespace detail {
+
+using futex_word = std::atomic<std::uint32_t>;
+
+static_assert(futex_word::is_always_lock_free && sizeof(futex_word) == sizeof(std::uint32_t),
+              "Futex words must be plain 32-bit integers in shared memory");
+
+// Sleeps while the word holds expected. Without FUTEX_PRIVATE_FLAG the kernel keys the wait by
+// the physical page, so it pairs with a wake through another mapping or from another process.
+// Spurious returns are fine, the callers check again.
+inline auto futex_wait(futex_word& word, std::uint32_t expected) noexcept -> void {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-type-vararg)
+  ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAIT, expected, nullptr,
+            nullptr, 0);
+}
+
+inline auto futex_wake_one(futex_word& word) noexcept -> void {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-type-vararg)
+  ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAKE, 1, nullptr, nullptr,
+            0);
+}
+
+// Shared read-write mapping of a whole file, the descriptor is not kept
+class shm_mapping {
+ public:
+  // -- Constructors
+
+  [[nodiscard]] shm_mapping() noexcept = default;
+
+  [[nodiscard]] shm_mapping(int file, std::size_t size) : size_(size) {
+    // NOLINTNEXTLINE(hicpp-signed-bitwise): Flags are ints in the C API
+    auto* mapped = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    if (mapped == MAP_FAILED) {
+      throw std::system_error(errno, std::system_category(), "mmap");
+    }
+    data_ = static_cast<std::byte*>(mapped);
+  }
+
+  shm_mapping(const shm_mapping&) = delete;
+
+  [[nodiscard]] shm_mapping(shm_mapping&& other) noexcept
+      : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+  // -- Destructor
+
+  ~shm_mapping() noexcept {
+    if (data_ != nullptr) {
+      ::munmap(data_, size_);
+    }
+  }
+
+  // -- Assignment
+
+  auto operator=(const shm_mapping&) -> shm_mapping& = delete;
+
+  auto operator=(shm_mapping&& other) noexcept -> shm_mapping& {
+    auto moved = shm_mapping(std::move(other));
+    std::swap(data_, moved.data_);
+    std::swap(size_, moved.size_);
+    return *this;
+  }
+
+  // -- Access
+
+  [[nodiscard]] auto data() const noexcept -> std::byte* { return data_; }
+
+  [[nodiscard]] auto size() const noexcept -> std::size_t { return size_; }
+
+ private:
+  std::byte* data_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+}  // namespace detail
+
+// == shm_ring implementation
+
+// Bounded queue for one producer and one consumer which may live in different processes. The
+// ring is a header followed by the slots in one shared memory file: anonymous (memfd) for
+// processes related by fork(), or named (shm_open) for unrelated ones. Every process maps it at
+// its own address, so the header holds the slots as an offset and nothing in it is a pointer.
+//
+// Head and tail are free-running 32-bit indices, each written by one side only, and double as
+// futex words: a blocked side spins briefly and then sleeps in FUTEX_WAIT on the other side's
+// index. Each index has a waiters count next to it, so publishing only enters the kernel when
+// somebody sleeps. Cached copies of the other side's index live in the handle, not in the
+// shared memory, so each process needs a handle of its own (one inherited by fork() is fine).
+template <class ValueType>
+  requires std::is_trivially_copyable_v<ValueType>
+class shm_ring {
+ public:
+  // -- Member types
+
+  using value_type = ValueType;
+  using size_type = std::size_t;
+
+  // -- Constants
+
+  constexpr static auto max_capacity = size_type{1} << 31U;
+
+  // -- Constructors
+
+  [[nodiscard]] shm_ring() noexcept = default;
+
+  // Anonymous ring, shared with the children forked after the call. Capacity is rounded up to a
+  // power of two.
+  [[nodiscard]] explicit shm_ring(size_type min_capacity) {
+    // NOLINTNEXTLINE(hicpp-signed-bitwise): Flags are ints in the C API
+    const auto file = ::memfd_create("dlgr_shm_ring", MFD_CLOEXEC);
+    if (file < 0) {
+      throw std::system_error(errno, std::system_category(), "memfd_create");
+    }
+    attach(init_file(file, min_capacity));
+  }
+
+  shm_ring(const shm_ring&) = delete;
+
+  [[nodiscard]] shm_ring(shm_ring&& other) noexcept
+      : mapping_(std::move(other.mapping_)),
+        header_(std::exchange(other.header_, nullptr)),
+        slots_(std::exchange(other.slots_, nullptr)),
+        mask_(std::exchange(other.mask_, 0)),
+        cached_head_(std::exchange(other.cached_head_, 0)),
+        cached_tail_(std::exchange(other.cached_tail_, 0)) {}
+
+  // -- Destructor
+
+  // Unmaps the ring, the memory lives as long as some process maps it (or the name exists)
+  ~shm_ring() noexcept = default;
+
+  // -- Assignment
+
+  auto operator=(const shm_ring&) -> shm_ring& = delete;
+
+  auto operator=(shm_ring&& other) noexcept -> shm_ring& {
+    if (this != &other) {
+      mapping_ = std::move(other.mapping_);
+      header_ = std::exchange(other.header_, nullptr);
+      slots_ = std::exchange(other.slots_, nullptr);
+      mask_ = std::exchange(other.mask_, 0);
+      cached_head_ = std::exchange(other.cached_head_, 0);
+      cached_tail_ = std::exchange(other.cached_tail_, 0);
+    }
+    return *this;
+  }
+
+  // -- Named rings
+
+  // Creates a new ring under a shm_open() name, fails if the name exists
+  [[nodiscard]] static auto create(const char* name, size_type min_capacity) -> shm_ring {
+    // NOLINTNEXTLINE(hicpp-signed-bitwise): Flags are ints in the C API
+    const auto file = ::shm_open(name, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+    if (file < 0) {
+      throw std::system_error(errno, std::system_category(), "shm_open");
+    }
+
+    auto ring = shm_ring();
+    try {
+      ring.attach(init_file(file, min_capacity));
+    } catch (...) {
+      ::shm_unlink(name);
+      throw;
+    }
+    return ring;
+  }
+
+  // Maps a ring made by create(), throws std::invalid_argument if it holds another type
+  [[nodiscard]] static auto open(const char* name) -> shm_ring {
+    // NOLINTNEXTLINE(hicpp-signed-bitwise): Flags are ints in the C API
+    const auto file = ::shm_open(name, O_RDWR | O_CLOEXEC, 0);
+    if (file < 0) {
+      throw std::system_error(errno, std::system_category(), "shm_open");
+    }
+
+    auto ring = shm_ring();
+    ring.attach(open_file(file));
+    return ring;
+  }
+
+  // Removes the name, the processes which have the ring mapped keep using it
+  static auto unlink(const char* name) -> void {
+    if (::shm_unlink(name) != 0) {
+      throw std::system_error(errno, std::system_category(), "shm_unlink");
+    }
+  }
+
+  // -- Capacity
+
+  [[nodiscard]] auto capacity() const noexcept -> size_type { return size_type{mask_} + 1; }
+
+  // Only a snapshot when the other side is running
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    const auto head = header_->head.load(std::memory_order::acquire);
+    const auto tail = header_->tail.load(std::memory_order::acquire);
+    return index_type{tail - head};
+  }
+
+  [[nodiscard]] auto empty() const noexcept -> bool { return size() == 0; }
+
+  // -- Producer side
+
+  auto try_push(const value_type& value) noexcept -> bool {
+    return push_bulk(std::span(&value, 1)) == 1;
+  }
+
+  // Copies the longest prefix of values which fits and returns its size
+  auto push_bulk(std::span<const value_type> values) noexcept -> size_type {
+    const auto tail = header_->tail.load(std::memory_order::relaxed);
+    auto free = size_type{capacity() - index_type{tail - cached_head_}};
+    if (free < values.size()) {
+      cached_head_ = header_->head.load(std::memory_order::acquire);
+      free = capacity() - index_type{tail - cached_head_};
+    }
+
+    const auto count = std::min(free, values.size());
+    if (count == 0) {
+      return 0;
+    }
+
+    const auto offset = size_type{tail & mask_};
+    const auto first_run = std::min(count, capacity() - offset);
+    std::memcpy(slots_ + offset, values.data(), first_run * sizeof(value_type));  // NOLINT
+    std::memcpy(slots_, values.data() + first_run,  // NOLINT(*-pointer-arithmetic)
+                (count - first_run) * sizeof(value_type));
+
+    publish(header_->tail, header_->tail_waiters, static_cast<index_type>(tail + count));
+    return count;
+  }
+
+  auto push(const value_type& value) noexcept -> void {
+    while (!try_push(value)) {
+      wait_for_change(header_->head, header_->head_waiters, cached_head_);
+    }
+  }
+
+  // -- Consumer side
+
+  auto try_pop() noexcept -> std::optional<value_type> {
+    const auto head = header_->head.load(std::memory_order::relaxed);
+    if (head == cached_tail_) {
+      cached_tail_ = header_->tail.load(std::memory_order::acquire);
+      if (head == cached_tail_) {
+        return std::nullopt;
+      }
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto value = std::optional<value_type>(slots_[head & mask_]);
+    publish(header_->head, header_->head_waiters, head + 1);
+    return value;
+  }
+
+  // Copies the available elements into the longest possible prefix of out and returns its size
+  auto pop_bulk(std::span<value_type> out) noexcept -> size_type {
+    const auto head = header_->head.load(std::memory_order::relaxed);
+    auto available = size_type{index_type{cached_tail_ - head}};
+    if (available < out.size()) {
+      cached_tail_ = header_->tail.load(std::memory_order::acquire);
+      available = index_type{cached_tail_ - head};
+    }
+
+    const auto count = std::min(available, out.size());
+    if (count == 0) {
+      return 0;
+    }
+
+    const auto offset = size_type{head & mask_};
+    const auto first_run = std::min(count, capacity() - offset);
+    std::memcpy(out.data(), slots_ + offset, first_run * sizeof(value_type));  // NOLINT
+    std::memcpy(out.data() + first_run, slots_,  // NOLINT(*-pointer-arithmetic)
+                (count - first_run) * sizeof(value_type));
+
+    publish(header_->head, header_->head_waiters, static_cast<index_type>(head + count));
+    return count;
+  }
+
+  auto pop() noexcept -> value_type {
+    while (true) {
+      if (auto value = try_pop()) {
+        return *value;
+      }
+      wait_for_change(header_->tail, header_->tail_waiters, cached_tail_);
+    }
+  }
+
+ private:
+  // -- Member types
+
+  using index_type = std::uint32_t;
+
+  // Placed at the start of the shared memory, the same in every process
+  struct header {
+    // Stored last by the creator, so open() never sees a half-written header
+    std::atomic<std::uint64_t> magic = 0;
+    std::uint64_t value_size = sizeof(value_type);
+    std::uint64_t value_alignment = alignof(value_type);
+    std::uint64_t capacity = 0;
+    std::uint64_t slots_offset = 0;
+
+    alignas(cache_line_size) detail::futex_word tail = 0;
+    detail::futex_word tail_waiters = 0;
+
+    alignas(cache_line_size) detail::futex_word head = 0;
+    detail::futex_word head_waiters = 0;
+  };
+
+  static_assert(std::is_standard_layout_v<header>);
+
+  // -- Constants
+
+  constexpr static auto magic_value = std::uint64_t{0x676e6972'5f6d6873};  // "shm_ring"
+  constexpr static auto slots_offset =
+      (sizeof(header) + alignof(value_type) - 1) / alignof(value_type) * alignof(value_type);
+  constexpr static auto spin_count = 256;
+
+  // -- Helper functions
+
+  // Sizes a fresh file, builds the header in it and maps it, always closes the file
+  [[nodiscard]] static auto init_file(int file, size_type min_capacity) -> detail::shm_mapping {
+    Expects(min_capacity <= max_capacity);
+    const auto capacity = std::bit_ceil(std::max(min_capacity, size_type{1}));
+    const auto size = slots_offset + capacity * sizeof(value_type);
+
+    auto mapping = detail::shm_mapping();
+    try {
+      if (::ftruncate(file, static_cast<::off_t>(size)) != 0) {
+        throw std::system_error(errno, std::system_category(), "ftruncate");
+      }
+      mapping = detail::shm_mapping(file, size);
+    } catch (...) {
+      ::close(file);
+      throw;
+    }
+    ::close(file);
+
+    auto* created = std::construct_at(reinterpret_cast<header*>(mapping.data()));  // NOLINT
+    created->capacity = capacity;
+    created->slots_offset = slots_offset;
+    created->magic.store(magic_value, std::memory_order::release);
+    return mapping;
+  }
+
+  // Maps an existing file and checks its header, always closes the file
+  [[nodiscard]] static auto open_file(int file) -> detail::shm_mapping {
+    auto mapping = detail::shm_mapping();
+    try {
+      struct ::stat file_stat = {};
+      if (::fstat(file, &file_stat) != 0) {
+        throw std::system_error(errno, std::system_category(), "fstat");
+      }
+      const auto size = static_cast<size_type>(file_stat.st_size);
+      if (size < slots_offset) {
+        throw std::invalid_argument("shm_ring: file too small");
+      }
+      mapping = detail::shm_mapping(file, size);
+    } catch (...) {
+      ::close(file);
+      throw;
+    }
+    ::close(file);
+
+    const auto& existing = *reinterpret_cast<const header*>(mapping.data());  // NOLINT
+    const auto capacity = static_cast<size_type>(existing.capacity);
+    if (existing.magic.load(std::memory_order::acquire) != magic_value
+        || existing.value_size != sizeof(value_type)
+        || existing.value_alignment != alignof(value_type) || existing.slots_offset != slots_offset
+        || !std::has_single_bit(capacity) || capacity > max_capacity
+        || mapping.size() < slots_offset + capacity * sizeof(value_type)) {
+      throw std::invalid_argument("shm_ring: not a ring of this value type");
+    }
+    return mapping;
+  }
+
+  auto attach(detail::shm_mapping mapping) noexcept -> void {
+    mapping_ = std::move(mapping);
+    header_ = reinterpret_cast<header*>(mapping_.data());  // NOLINT(*-reinterpret-cast)
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, *-pointer-arithmetic)
+    slots_ = reinterpret_cast<value_type*>(mapping_.data() + header_->slots_offset);
+    mask_ = static_cast<index_type>(header_->capacity - 1);
+    cached_head_ = header_->head.load(std::memory_order::acquire);
+    cached_tail_ = header_->tail.load(std::memory_order::acquire);
+  }
+
+  // The index store and the waiters load are sequentially consistent, as are the waiters
+  // increment and the index load in wait_for_change(), so either the waiter sees the new index
+  // or the publisher sees the waiter
+  static auto publish(detail::futex_word& index, detail::futex_word& waiters,
+                      index_type value) noexcept -> void {
+    index.store(value, std::memory_order::seq_cst);
+    if (waiters.load(std::memory_order::seq_cst) != 0) {
+      detail::futex_wake_one(index);
+    }
+  }
+
+  static auto wait_for_change(detail::futex_word& index, detail::futex_word& waiters,
+                              index_type seen) noexcept -> void {
+    for (auto spin = 0; spin < spin_count; ++spin) {
+      if (index.load(std::memory_order::relaxed) != seen) {
+        return;
+      }
+    }
+
+    waiters.fetch_add(1, std::memory_order::seq_cst);
+    if (index.load(std::memory_order::seq_cst) == seen) {
+      detail::futex_wait(index, seen);
+    }
+    waiters.fetch_sub(1, std::memory_order::relaxed);
+  }
+
+  // -- Data members
+
+  detail::shm_mapping mapping_ = {};
+  header* header_ = nullptr;
+  value_type* slots_ = nullptr;
+  index_type mask_ = 0;
+
+  // Process-local, each used by one side only
+  index_type cached_head_ = 0;
+  index_type cached_tail_ = 0;
+};
+
+}  // namespace dlgr
@@ -0,0 +1,244 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include <dlgr/cache_line.h>
+
+namespace dlgr {
+
+// == spsc_ring implementation
+
+// Bounded lock-free queue for exactly one producer thread and one consumer thread.
+//
+// Head and tail are free-running indices, each written by one side only and kept on its own
+// cache line together with that side's cached copy of the other index, so the shared index is
+// re-read only when the cached one says the queue looks full (or empty). Blocking push() and
+// pop() park on the other side's index with std::atomic::wait.
+template <class ValueType, class Allocator = std::allocator<ValueType>>
+class spsc_ring {
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  static_assert(std::is_same_v<typename alloc_traits::value_type, ValueType>);
+
+ public:
+  // -- Member types
+
+  using value_type = ValueType;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+
+  // -- Constructors
+
+  // Capacity is rounded up to a power of two
+  [[nodiscard]] explicit spsc_ring(size_type min_capacity,
+                                   const allocator_type& alloc = allocator_type())
+      : alloc_(alloc),
+        capacity_(std::bit_ceil(std::max(min_capacity, size_type{1}))),
+        mask_(capacity_ - 1),
+        data_(alloc_traits::allocate(alloc_, capacity_)) {}
+
+  spsc_ring(const spsc_ring&) = delete;
+  spsc_ring(spsc_ring&&) = delete;
+
+  // -- Destructor
+
+  ~spsc_ring() noexcept {
+    const auto tail = producer_.index.load(std::memory_order::acquire);
+    for (auto head = consumer_.index.load(std::memory_order::relaxed); head != tail; ++head) {
+      alloc_traits::destroy(alloc_, slot(head));
+    }
+    alloc_traits::deallocate(alloc_, data_, capacity_);
+  }
+
+  // -- Assignment
+
+  auto operator=(const spsc_ring&) -> spsc_ring& = delete;
+  auto operator=(spsc_ring&&) -> spsc_ring& = delete;
+
+  // -- Capacity
+
+  [[nodiscard]] constexpr auto capacity() const noexcept -> size_type { return capacity_; }
+
+  // Only a snapshot when the other side is running
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    const auto head = consumer_.index.load(std::memory_order::acquire);
+    const auto tail = producer_.index.load(std::memory_order::acquire);
+    return tail - head;
+  }
+
+  [[nodiscard]] auto empty() const noexcept -> bool { return size() == 0; }
+
+  // -- Producer side
+
+  template <class... ArgTypes>
+    requires std::constructible_from<value_type, ArgTypes...>
+  auto try_emplace(ArgTypes&&... args) -> bool {
+    const auto tail = producer_.index.load(std::memory_order::relaxed);
+    if (tail - producer_.cached_other == capacity_) {
+      producer_.cached_other = consumer_.index.load(std::memory_order::acquire);
+      if (tail - producer_.cached_other == capacity_) {
+        return false;
+      }
+    }
+
+    alloc_traits::construct(alloc_, slot(tail), std::forward<ArgTypes>(args)...);
+    publish(producer_, tail + 1);
+    return true;
+  }
+
+  auto try_push(const value_type& value) -> bool { return try_emplace(value); }
+
+  auto try_push(value_type&& value) -> bool { return try_emplace(std::move(value)); }
+
+  // Copies the longest prefix of values which fits and returns its size
+  auto push_bulk(std::span<const value_type> values) -> size_type
+    requires std::copy_constructible<value_type>
+  {
+    const auto tail = producer_.index.load(std::memory_order::relaxed);
+    auto free = capacity_ - (tail - producer_.cached_other);
+    if (free < values.size()) {
+      producer_.cached_other = consumer_.index.load(std::memory_order::acquire);
+      free = capacity_ - (tail - producer_.cached_other);
+    }
+
+    const auto count = std::min(free, values.size());
+    if (count == 0) {
+      return 0;
+    }
+
+    const auto offset = tail & mask_;
+    const auto first_run = std::min(count, capacity_ - offset);
+    construct_run(offset, values.first(first_run));
+    construct_run(0, values.subspan(first_run, count - first_run));
+
+    publish(producer_, tail + count);
+    return count;
+  }
+
+  template <class... ArgTypes>
+    requires std::constructible_from<value_type, ArgTypes...>
+  auto emplace(ArgTypes&&... args) -> void {
+    while (!try_emplace(std::forward<ArgTypes>(args)...)) {
+      consumer_.index.wait(producer_.cached_other, std::memory_order::acquire);
+    }
+  }
+
+  auto push(const value_type& value) -> void { emplace(value); }
+
+  auto push(value_type&& value) -> void { emplace(std::move(value)); }
+
+  // -- Consumer side
+
+  auto try_pop() -> std::optional<value_type> {
+    const auto head = consumer_.index.load(std::memory_order::relaxed);
+    if (head == consumer_.cached_other) {
+      consumer_.cached_other = producer_.index.load(std::memory_order::acquire);
+      if (head == consumer_.cached_other) {
+        return std::nullopt;
+      }
+    }
+
+    auto* src = slot(head);
+    auto value = std::optional<value_type>(std::move(*src));
+    alloc_traits::destroy(alloc_, src);
+    publish(consumer_, head + 1);
+    return value;
+  }
+
+  // Moves the available elements into the longest possible prefix of out and returns its size
+  auto pop_bulk(std::span<value_type> out) -> size_type {
+    const auto head = consumer_.index.load(std::memory_order::relaxed);
+    auto available = consumer_.cached_other - head;
+    if (available < out.size()) {
+      consumer_.cached_other = producer_.index.load(std::memory_order::acquire);
+      available = consumer_.cached_other - head;
+    }
+
+    const auto count = std::min(available, out.size());
+    if (count == 0) {
+      return 0;
+    }
+
+    const auto offset = head & mask_;
+    const auto first_run = std::min(count, capacity_ - offset);
+    move_run(offset, out.first(first_run));
+    move_run(0, out.subspan(first_run, count - first_run));
+
+    publish(consumer_, head + count);
+    return count;
+  }
+
+  auto pop() -> value_type {
+    while (true) {
+      if (auto value = try_pop()) {
+        return std::move(*value);
+      }
+      producer_.index.wait(consumer_.cached_other, std::memory_order::acquire);
+    }
+  }
+
+ private:
+  // -- Member types
+
+  // Index written by one side and that side's cached copy of the other side's index
+  struct alignas(cache_line_size) side {
+    std::atomic<size_type> index = 0;
+    size_type cached_other = 0;
+  };
+
+  // -- Helper functions
+
+  [[nodiscard]] auto slot(size_type index) const noexcept -> value_type* {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return std::to_address(data_) + (index & mask_);
+  }
+
+  auto construct_run(size_type offset, std::span<const value_type> values) -> void {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto* dest = std::to_address(data_) + offset;
+    for (const auto& value : values) {
+      alloc_traits::construct(alloc_, dest, value);
+      ++dest;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
+
+  auto move_run(size_type offset, std::span<value_type> out) -> void {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto* src = std::to_address(data_) + offset;
+    for (auto& value : out) {
+      value = std::move(*src);
+      alloc_traits::destroy(alloc_, src);
+      ++src;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
+
+  // Notifying is cheap while nobody waits, and a blocked peer needs it even after try_* calls
+  static auto publish(side& own, size_type index) noexcept -> void {
+    own.index.store(index, std::memory_order::release);
+    own.index.notify_one();
+  }
+
+  // -- Data members
+
+  // Read-only after construction, so sharing the line between both sides is fine
+  [[no_unique_address]] allocator_type alloc_ = {};
+  size_type capacity_ = 0;
+  size_type mask_ = 0;
+  typename alloc_traits::pointer data_ = nullptr;
+
+  side producer_ = {};
+  side consumer_ = {};
+};
+
+}  // namespace dlgr
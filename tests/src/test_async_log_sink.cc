@@ -0,0 +1,186 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <dlgr/async_log_sink.h>
+
+namespace {
+
+using dlgr::async_log_block_t;
+using dlgr::async_log_drop_t;
+using dlgr::async_log_overwrite_t;
+using dlgr::async_log_sink;
+
+// The background thread only runs when asked to, which keeps the overflow cases deterministic
+constexpr auto sleepy = std::chrono::hours(1);
+
+class pipe_fds {
+ public:
+  pipe_fds() {
+    if (::pipe(fds_.data()) != 0) {
+      throw std::system_error(errno, std::system_category(), "pipe");
+    }
+  }
+
+  pipe_fds(const pipe_fds&) = delete;
+  pipe_fds(pipe_fds&&) = delete;
+
+  ~pipe_fds() noexcept {
+    for (auto fd : fds_) {
+      if (fd >= 0) {
+        ::close(fd);
+      }
+    }
+  }
+
+  auto operator=(const pipe_fds&) -> pipe_fds& = delete;
+  auto operator=(pipe_fds&&) -> pipe_fds& = delete;
+
+  [[nodiscard]] auto writer() const noexcept -> int { return fds_[1]; }
+
+  // Everything written so far
+  auto read_available() const -> std::string {
+    REQUIRE(::fcntl(fds_[0], F_SETFL, O_NONBLOCK) == 0);
+    auto out = std::string();
+    auto chunk = std::array<char, 4'096>{};
+    for (auto bytes = ::read(fds_[0], chunk.data(), chunk.size()); bytes > 0;
+         bytes = ::read(fds_[0], chunk.data(), chunk.size())) {
+      out.append(chunk.data(), static_cast<std::size_t>(bytes));
+    }
+    return out;
+  }
+
+ private:
+  std::array<int, 2> fds_ = {-1, -1};
+};
+
+}  // namespace
+
+// NOLINTBEGIN
+TEST_CASE("async_log_sink producers", "[async_log_sink]") {  // cppcheck-suppress[naming-functionName]
+  constexpr auto producers_count = 3;
+  constexpr auto records_count = 1'000;
+
+  auto fds = pipe_fds();
+  {
+    auto sink = async_log_sink<async_log_block_t>(fds.writer(), 64, std::chrono::microseconds(50));
+    CHECK(sink.ring_capacity() == 64);
+
+    auto threads = std::vector<std::thread>();
+    for (auto id = 0; id < producers_count; ++id) {
+      threads.emplace_back([&sink, id, producer = sink.make_producer()]() mutable {
+        for (auto idx = 0; idx < records_count; ++idx) {
+          const auto record = std::to_string(id) + ' ' + std::to_string(idx) + '\n';
+          CHECK(producer.append(record));
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    CHECK(sink.dropped() == 0);
+  }
+
+  // Records of one producer come out whole and in order
+  auto next = std::vector<int>(producers_count, 0);
+  auto lines = std::istringstream(fds.read_available());
+  auto id = 0;
+  auto idx = 0;
+  while (lines >> id >> idx) {
+    REQUIRE(id < producers_count);
+    CHECK(idx == next[id]++);
+  }
+  CHECK(next == std::vector<int>(producers_count, records_count));
+}
+
+TEST_CASE("async_log_sink drop", "[async_log_sink]") {  // cppcheck-suppress[naming-functionName]
+  auto fds = pipe_fds();
+  auto sink = async_log_sink<async_log_drop_t>(fds.writer(), 16, sleepy);
+  auto producer = sink.make_producer();
+
+  CHECK(producer.append("first\n"));
+  CHECK(producer.append("second\n"));
+  CHECK(!producer.append("third\n"));
+  CHECK(!producer.append("longer than the ring\n"));
+  CHECK(producer.append(""));
+  CHECK(sink.dropped() == 2);
+
+  sink.flush();
+  CHECK(fds.read_available() == "first\nsecond\n");
+
+  // Written bytes make room again, also across the end of the ring
+  CHECK(producer.append("fourth\n"));
+  CHECK(producer.append("fifth\n"));
+  sink.flush();
+  CHECK(fds.read_available() == "fourth\nfifth\n");
+  CHECK(sink.dropped() == 2);
+  CHECK(!sink.error());
+}
+
+TEST_CASE("async_log_sink overwrite", "[async_log_sink]") {  // cppcheck-suppress[naming-functionName]
+  auto fds = pipe_fds();
+  auto sink = async_log_sink<async_log_overwrite_t>(fds.writer(), 16, sleepy);
+  auto producer = sink.make_producer();
+
+  CHECK(producer.append("one\n"));
+  CHECK(producer.append("two\n"));
+  CHECK(producer.append("three\n"));
+  CHECK(producer.append("four\n"));
+  CHECK(producer.append("five\n"));
+  CHECK(sink.dropped() == 2);
+
+  sink.flush();
+  CHECK(fds.read_available() == "three\nfour\nfive\n");
+
+  CHECK(!producer.append("longer than the ring\n"));
+  CHECK(sink.dropped() == 3);
+}
+
+TEST_CASE("async_log_sink block", "[async_log_sink]") {  // cppcheck-suppress[naming-functionName]
+  auto fds = pipe_fds();
+  auto sink = async_log_sink<async_log_block_t>(fds.writer(), 16, sleepy);
+  auto producer = sink.make_producer();
+
+  // Every record after the first waits for the one before it to be written
+  for (auto idx = 0; idx < 20; ++idx) {
+    CHECK(producer.append("0123456789\n"));
+  }
+  sink.flush();
+
+  auto expected = std::string();
+  for (auto idx = 0; idx < 20; ++idx) {
+    expected += "0123456789\n";
+  }
+  CHECK(fds.read_available() == expected);
+  CHECK(sink.dropped() == 0);
+}
+
+TEST_CASE("async_log_sink errors", "[async_log_sink]") {  // cppcheck-suppress[naming-functionName]
+  auto sink = async_log_sink<async_log_block_t>(-1, 16, sleepy);
+  auto producer = sink.make_producer();
+
+  // Failed writes still free the ring, so nobody waits forever
+  for (auto idx = 0; idx < 4; ++idx) {
+    CHECK(producer.append("0123456789\n"));
+  }
+  sink.flush();
+  CHECK(sink.error() == std::error_code(EBADF, std::system_category()));
+}
+// NOLINTEND
+
+#endif  // defined(__unix__) || defined(__APPLE__)
@@ -0,0 +1,119 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <ranges>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <dlgr/broadcast_ring.h>
+
+namespace {
+
+template <class RangeType>
+auto to_vector(RangeType&& range) {
+  return std::vector(std::ranges::begin(range), std::ranges::end(range));
+}
+
+}  // namespace
+
+// NOLINTBEGIN
+TEST_CASE("broadcast_ring single thread", "[broadcast_ring]") {  // cppcheck-suppress[naming-functionName]
+  auto ring = dlgr::broadcast_ring<int>(3, 2);
+  CHECK(ring.capacity() == 4);
+  CHECK(ring.consumers_count() == 2);
+
+  auto fast = ring.make_consumer(0);
+  auto slow = ring.make_consumer(1);
+  CHECK(fast.available().empty());
+
+  for (auto val = 0; val < 4; ++val) {
+    CHECK(ring.try_push(val));
+  }
+  CHECK_FALSE(ring.try_push(-1));
+
+  // Every consumer sees every element
+  CHECK(to_vector(fast.available()) == std::vector{0, 1, 2, 3});
+  CHECK(to_vector(slow.available()) == std::vector{0, 1, 2, 3});
+
+  // The producer is gated on the slowest consumer
+  fast.release(4);
+  CHECK(fast.available().empty());
+  CHECK_FALSE(ring.try_push(-1));
+
+  slow.release(1);
+  CHECK(ring.try_push(4));
+  CHECK_FALSE(ring.try_push(-1));
+  CHECK(to_vector(fast.available()) == std::vector{4});
+  CHECK(to_vector(slow.available()) == std::vector{1, 2, 3, 4});
+}
+
+TEST_CASE("broadcast_ring batches", "[broadcast_ring]") {  // cppcheck-suppress[naming-functionName]
+  auto ring = dlgr::broadcast_ring<std::string>(8, 1);
+  auto reader = ring.make_consumer(0);
+
+  auto slots = ring.try_claim(5);
+  CHECK(slots.size() == 5);
+  std::ranges::fill(slots, "a");
+  ring.publish(5);
+  CHECK(reader.available().size() == 5);
+  reader.release(5);
+
+  // Claims wrap around the end of the storage and stop at the slowest consumer
+  slots = ring.try_claim(10);
+  CHECK(slots.size() == 8);
+  auto idx = 0;
+  for (auto& slot : slots) {
+    slot = std::to_string(idx++);
+  }
+
+  // Only what has been published is visible
+  ring.publish(6);
+  auto batch = reader.available();
+  CHECK(to_vector(batch) == std::vector<std::string>{"0", "1", "2", "3", "4", "5"});
+  CHECK(std::ranges::size(dlgr::ranges::ring_segments(batch)) == 2);
+
+  reader.release(2);
+  CHECK(to_vector(reader.available()) == std::vector<std::string>{"2", "3", "4", "5"});
+  CHECK(ring.try_claim(10).size() == 4);
+}
+
+TEST_CASE("broadcast_ring threads", "[broadcast_ring]") {  // cppcheck-suppress[naming-functionName]
+  constexpr auto count = std::size_t{100'000};
+  constexpr auto consumers_count = std::size_t{3};
+  auto ring = dlgr::broadcast_ring<std::size_t>(64, consumers_count);
+
+  auto ordered = std::vector<char>(consumers_count, 0);
+  auto threads = std::vector<std::thread>();
+  for (auto id = std::size_t{0}; id < consumers_count; ++id) {
+    threads.emplace_back([&ordered, id, reader = ring.make_consumer(id)]() mutable {
+      auto in_order = true;
+      for (auto next = std::size_t{0}; next < count;) {
+        const auto batch = reader.wait();
+        for (auto value : batch) {
+          in_order = in_order && value == next++;
+        }
+        reader.release(batch.size());
+      }
+      ordered[id] = in_order ? 1 : 0;
+    });
+  }
+
+  for (auto next = std::size_t{0}; next < count;) {
+    auto slots = ring.claim(std::min(std::size_t{16}, count - next));
+    for (auto& slot : slots) {
+      slot = next++;
+    }
+    ring.publish(slots.size());
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  CHECK(ordered == std::vector<char>(consumers_count, 1));
+}
+// NOLINTEND
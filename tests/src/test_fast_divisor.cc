@@ -0,0 +1,86 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <catch2/generators/catch_generators_random.hpp>
+
+#include <cstdint>
+#include <limits>
+
+#include <dlgr/fast_divisor.h>
+
+namespace {
+
+using dlgr::fast_divisor;
+
+template <class IntegerType>
+auto check_div_mod(IntegerType divisor, IntegerType num) -> void {
+  const auto fast = fast_divisor<IntegerType>(divisor);
+  const auto result = fast.div_mod(num);
+
+  CHECK(fast.value() == divisor);
+  CHECK(fast.div(num) == num / divisor);
+  CHECK(result.quot == num / divisor);
+  CHECK(result.rem == num % divisor);
+}
+
+}  // namespace
+
+// NOLINTBEGIN
+TEST_CASE("fast_divisor small values", "[fast_divisor]") {  // cppcheck-suppress[naming-functionName]
+  for (auto divisor = 1; divisor < 128; ++divisor) {
+    for (auto num = 0; num < 512; ++num) {
+      check_div_mod<std::int32_t>(divisor, num);
+      check_div_mod<std::uint16_t>(static_cast<std::uint16_t>(divisor),
+                                   static_cast<std::uint16_t>(num));
+      check_div_mod<std::int64_t>(divisor, num);
+    }
+  }
+}
+
+TEST_CASE("fast_divisor power of two", "[fast_divisor]") {  // cppcheck-suppress[naming-functionName]
+  for (auto shift = 0U; shift < 63U; ++shift) {
+    const auto divisor = std::int64_t{1} << shift;
+    CHECK(fast_divisor(divisor).is_power_of_two());
+    CHECK(fast_divisor(divisor + 1).is_power_of_two() == (shift == 0));
+    check_div_mod(divisor, std::numeric_limits<std::int64_t>::max());
+    check_div_mod(divisor, (divisor - 1) * 2 + 1);
+  }
+}
+
+TEST_CASE("fast_divisor random values", "[fast_divisor]") {  // cppcheck-suppress[naming-functionName]
+  using ::Catch::Generators::random;
+  using ::Catch::Generators::take;
+
+  SECTION("int64") {
+    constexpr auto max = std::numeric_limits<std::int64_t>::max();
+    const auto divisor = GENERATE(take(100, random<std::int64_t>(1, max)));
+    const auto num = GENERATE(take(100, random<std::int64_t>(0, max)));
+    check_div_mod(divisor, num);
+    check_div_mod(divisor >> 32U | 1, num);
+  }
+
+  SECTION("uint64") {
+    constexpr auto max = std::numeric_limits<std::uint64_t>::max();
+    const auto divisor = GENERATE(take(100, random<std::uint64_t>(1, max)));
+    const auto num = GENERATE(take(100, random<std::uint64_t>(0, max)));
+    check_div_mod(divisor, num);
+    check_div_mod(divisor, max);
+  }
+
+  SECTION("uint32") {
+    constexpr auto max = std::numeric_limits<std::uint32_t>::max();
+    const auto divisor = GENERATE(take(100, random<std::uint32_t>(1, max)));
+    const auto num = GENERATE(take(100, random<std::uint32_t>(0, max)));
+    check_div_mod(divisor, num);
+  }
+}
+
+TEST_CASE("fast_divisor constexpr", "[fast_divisor]") {  // cppcheck-suppress[naming-functionName]
+  constexpr auto divisor = fast_divisor<std::int64_t>(7);
+  STATIC_CHECK(divisor.div(100) == 14);
+  STATIC_CHECK(divisor.mod(100) == 2);
+  STATIC_CHECK(fast_divisor<std::uint64_t>(12).div_mod(std::uint64_t{1} << 63U).rem == 8);
+}
+// NOLINTEND
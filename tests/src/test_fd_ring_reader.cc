@@ -0,0 +1,204 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <dlgr/fd_ring_reader.h>
+
+namespace {
+
+using dlgr::fd_ring_reader;
+
+class pipe_fds {
+ public:
+  pipe_fds() {
+    if (::pipe(fds_.data()) != 0) {
+      throw std::system_error(errno, std::system_category(), "pipe");
+    }
+  }
+
+  pipe_fds(const pipe_fds&) = delete;
+  pipe_fds(pipe_fds&&) = delete;
+
+  ~pipe_fds() noexcept {
+    for (auto fd : fds_) {
+      if (fd >= 0) {
+        ::close(fd);
+      }
+    }
+  }
+
+  auto operator=(const pipe_fds&) -> pipe_fds& = delete;
+  auto operator=(pipe_fds&&) -> pipe_fds& = delete;
+
+  [[nodiscard]] auto reader() const noexcept -> int { return fds_[0]; }
+
+  [[nodiscard]] auto writer() const noexcept -> int { return fds_[1]; }
+
+  auto write(const std::vector<std::byte>& bytes) const -> void {
+    REQUIRE(::write(writer(), bytes.data(), bytes.size())
+            == static_cast<::ssize_t>(bytes.size()));
+  }
+
+  auto close_writer() noexcept -> void {
+    ::close(fds_[1]);
+    fds_[1] = -1;
+  }
+
+ private:
+  std::array<int, 2> fds_ = {-1, -1};
+};
+
+auto make_bytes(std::size_t size, int first) -> std::vector<std::byte> {
+  auto out = std::vector<std::byte>(size);
+  std::ranges::generate(out, [val = first]() mutable { return static_cast<std::byte>(val++); });
+  return out;
+}
+
+// Frames with a 16-bit prefix in the given byte order
+auto make_stream(const std::vector<std::vector<std::byte>>& payloads, std::endian order) {
+  auto out = std::vector<std::byte>();
+  for (const auto& payload : payloads) {
+    const auto low = static_cast<std::byte>(payload.size() & 0xFFU);
+    const auto high = static_cast<std::byte>(payload.size() >> 8U);
+    out.push_back(order == std::endian::little ? low : high);
+    out.push_back(order == std::endian::little ? high : low);
+    out.insert(out.end(), payload.begin(), payload.end());
+  }
+  return out;
+}
+
+}  // namespace
+
+// NOLINTBEGIN
+TEST_CASE("fd_ring_reader fill", "[fd_ring_reader]") {  // cppcheck-suppress[naming-functionName]
+  auto fds = pipe_fds();
+  auto reader = fd_ring_reader(fds.reader(), 8);
+  CHECK(reader.capacity() == 8);
+  CHECK(reader.empty());
+
+  fds.write(make_bytes(6, 0));
+  CHECK(reader.fill() == 6);
+  reader.release(5);
+  CHECK(reader.size() == 1);
+
+  // The free space is split by the end of the storage and one read fills both parts
+  fds.write(make_bytes(10, 6));
+  CHECK(reader.fill() == 7);
+  CHECK(reader.full());
+  CHECK(reader.fill() == 0);
+
+  const auto spans = reader.as_spans();
+  CHECK(spans[0].size() == 3);
+  CHECK(spans[1].size() == 5);
+  CHECK(std::ranges::equal(reader.bytes(0, 8), make_bytes(8, 5)));
+  CHECK(std::ranges::equal(reader.bytes(2, 3), make_bytes(3, 7)));
+
+  reader.release(8);
+  CHECK(reader.fill() == 3);
+  CHECK(std::ranges::equal(reader.bytes(0, 3), make_bytes(3, 13)));
+
+  fds.close_writer();
+  CHECK(!reader.eof());
+  CHECK(reader.fill() == 0);
+  CHECK(reader.eof());
+  CHECK(reader.size() == 3);
+}
+
+TEST_CASE("fd_ring_reader frames", "[fd_ring_reader]") {  // cppcheck-suppress[naming-functionName]
+  const auto order = GENERATE(std::endian::little, std::endian::big);
+  const auto capacity = GENERATE(std::size_t{16}, 17, 41);
+
+  auto payloads = std::vector<std::vector<std::byte>>();
+  for (auto idx = 0; idx < 40; ++idx) {
+    payloads.push_back(make_bytes(static_cast<std::size_t>(idx * 5 % 15), idx));
+  }
+
+  auto fds = pipe_fds();
+  fds.write(make_stream(payloads, order));
+  fds.close_writer();
+
+  auto reader = fd_ring_reader(fds.reader(), capacity);
+  auto received = std::vector<std::vector<std::byte>>();
+  auto crossed = 0;
+
+  while (true) {
+    const auto frame = order == std::endian::little
+                           ? reader.next_frame<std::uint16_t>()
+                           : reader.next_frame<std::uint16_t, std::endian::big>();
+    if (!frame) {
+      if (reader.eof()) {
+        break;
+      }
+      reader.fill();
+      continue;
+    }
+
+    received.emplace_back(frame->bytes().begin(), frame->bytes().end());
+    if (const auto span = frame->contiguous()) {
+      CHECK(std::ranges::equal(*span, frame->bytes()));
+    } else {
+      ++crossed;
+    }
+    CHECK(frame->wire_size() == frame->size() + 2);
+    reader.release(*frame);
+  }
+
+  CHECK(received == payloads);
+  CHECK(reader.empty());
+  CHECK(crossed > 0);
+}
+
+TEST_CASE("fd_ring_reader errors", "[fd_ring_reader]") {  // cppcheck-suppress[naming-functionName]
+  SECTION("would block") {
+    auto fds = pipe_fds();
+    REQUIRE(::fcntl(fds.reader(), F_SETFL, O_NONBLOCK) == 0);
+    auto reader = fd_ring_reader(fds.reader(), 8);
+    CHECK(reader.fill() == 0);
+    CHECK(!reader.eof());
+  }
+
+  SECTION("bad descriptor") {
+    auto reader = fd_ring_reader(-1, 8);
+    CHECK_THROWS_AS(reader.fill(), std::system_error);
+  }
+
+  SECTION("frame too large") {
+    auto fds = pipe_fds();
+    fds.write(make_stream({make_bytes(7, 0)}, std::endian::little));
+    auto reader = fd_ring_reader(fds.reader(), 8);
+    reader.fill();
+    CHECK_THROWS_AS(reader.next_frame<std::uint16_t>(), std::length_error);
+  }
+
+  SECTION("move") {
+    auto fds = pipe_fds();
+    fds.write(make_bytes(3, 0));
+    auto reader = fd_ring_reader(fds.reader(), 8);
+    reader.fill();
+    auto moved = std::move(reader);
+    CHECK(moved.size() == 3);
+    CHECK(moved.fd() == fds.reader());
+    CHECK(reader.capacity() == 0);  // NOLINT(bugprone-use-after-move)
+    CHECK(reader.fill() == 0);
+  }
+}
+// NOLINTEND
+
+#endif  // defined(__unix__) || defined(__APPLE__)
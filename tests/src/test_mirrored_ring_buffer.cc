@@ -0,0 +1,92 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#if defined(__linux__)
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <dlgr/mirrored_ring_buffer.h>
+
+// NOLINTBEGIN
+TEST_CASE("mirrored_ring_buffer size", "[mirrored]") {  // cppcheck-suppress[naming-functionName]
+  const auto page_size = dlgr::detail::mirrored_mapping::page_size();
+
+  CHECK(dlgr::mirrored_ring_buffer<char>(1).capacity() == page_size);
+  CHECK(dlgr::mirrored_ring_buffer<char>(page_size + 1).capacity() == 2 * page_size);
+  CHECK(dlgr::mirrored_ring_buffer<std::uint64_t>(3).capacity() == page_size / 8);
+
+  struct three_bytes {
+    char data[3];
+  };
+  CHECK(dlgr::mirrored_ring_buffer<three_bytes>(1).capacity() == page_size);
+
+  STATIC_CHECK(std::ranges::contiguous_range<dlgr::mirrored_ring_buffer<int>>);
+}
+
+TEST_CASE("mirrored_ring_buffer wrap", "[mirrored]") {  // cppcheck-suppress[naming-functionName]
+  auto buf = dlgr::mirrored_ring_buffer<int>(1);
+  const auto capacity = buf.capacity();
+
+  auto values = std::vector<int>(capacity);
+  std::iota(values.begin(), values.end(), 0);
+
+  CHECK(buf.push_n(values) == capacity);
+  CHECK(buf.full());
+  CHECK_FALSE(buf.push_back(-1));
+
+  buf.consume(capacity - 2);
+  CHECK(buf.push_n(std::vector{100, 101, 102}) == 3);
+
+  // The window crosses the end of the storage and still is one span
+  const auto window = buf.as_span();
+  CHECK(window.size() == 5);
+  CHECK(std::vector(window.begin(), window.end())
+        == std::vector{static_cast<int>(capacity) - 2, static_cast<int>(capacity) - 1, 100, 101,
+                       102});
+  CHECK(buf.front() == static_cast<int>(capacity) - 2);
+  CHECK(buf.back() == 102);
+  CHECK(buf[2] == 100);
+
+  auto out = std::vector<int>(4);
+  CHECK(buf.pop_n(out) == 4);
+  CHECK(out[3] == 101);
+  CHECK(buf.size() == 1);
+  CHECK(buf.front() == 102);
+}
+
+TEST_CASE("mirrored_ring_buffer commit", "[mirrored]") {  // cppcheck-suppress[naming-functionName]
+  auto buf = dlgr::mirrored_ring_buffer<char>(1);
+  const auto capacity = buf.capacity();
+
+  for (auto lap = 0; lap < 3; ++lap) {
+    auto free = buf.free_span();
+    CHECK(free.size() == capacity - buf.size());
+
+    constexpr auto message = std::string_view("hello, world");
+    const auto count = std::min(free.size(), capacity / 2 + 1);
+    for (auto index = std::size_t{0}; index < count; ++index) {
+      free[index] = message[index % message.size()];
+    }
+    buf.commit(count);
+
+    const auto text = std::string_view(buf.begin(), buf.end());
+    CHECK(text.starts_with(message));
+    buf.consume(count);
+    CHECK(buf.empty());
+  }
+
+  auto moved = std::move(buf);
+  CHECK(moved.capacity() == capacity);
+  CHECK(buf.capacity() == 0);  // NOLINT(bugprone-use-after-move)
+}
+// NOLINTEND
+
+#endif  // defined(__linux__)
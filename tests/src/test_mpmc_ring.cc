@@ -0,0 +1,126 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <dlgr/mpmc_ring.h>
+
+// NOLINTBEGIN
+TEST_CASE("mpmc_ring single thread", "[mpmc_ring]") {  // cppcheck-suppress[naming-functionName]
+  auto ring = dlgr::mpmc_ring<int>(3);
+
+  CHECK(ring.capacity() == 4);
+  CHECK_FALSE(ring.try_pop().has_value());
+
+  for (auto lap = 0; lap < 3; ++lap) {
+    for (auto val = 0; val < 4; ++val) {
+      CHECK(ring.try_push(lap * 10 + val));
+    }
+    CHECK_FALSE(ring.try_push(-1));
+
+    for (auto val = 0; val < 4; ++val) {
+      CHECK(ring.try_pop() == lap * 10 + val);
+    }
+    CHECK_FALSE(ring.try_pop().has_value());
+  }
+
+  CHECK(dlgr::mpmc_ring<int>(1).capacity() == 2);
+}
+
+TEST_CASE("mpmc_ring elements lifetime", "[mpmc_ring]") {  // cppcheck-suppress[naming-functionName]
+  auto tracker = std::make_shared<int>(0);
+
+  {
+    auto ring = dlgr::mpmc_ring<std::shared_ptr<int>>(4);
+    for (auto iter = 0; iter < 3; ++iter) {
+      CHECK(ring.try_push(tracker));
+    }
+    CHECK(tracker.use_count() == 4);
+
+    ring.try_pop();
+    CHECK(tracker.use_count() == 3);
+  }
+
+  CHECK(tracker.use_count() == 1);
+}
+
+TEST_CASE("mpmc_ring throwing constructor", "[mpmc_ring]") {  // cppcheck-suppress[naming-functionName]
+  struct picky {
+    explicit picky(int val) : value(val) {
+      if (val < 0) {
+        throw std::invalid_argument("negative");
+      }
+    }
+
+    int value = 0;
+  };
+
+  auto ring = dlgr::mpmc_ring<picky>(2);
+
+  // A failed construction must not hold on to a ticket, or the pushes behind it would wait for it
+  for (auto lap = 0; lap < 3; ++lap) {
+    CHECK_THROWS_AS(ring.try_emplace(-1), std::invalid_argument);
+    CHECK_THROWS_AS(ring.emplace(-1), std::invalid_argument);
+    CHECK(ring.try_emplace(lap));
+    ring.emplace(lap + 10);
+    CHECK_FALSE(ring.try_emplace(lap + 20));
+
+    CHECK(ring.pop().value == lap);
+    CHECK(ring.pop().value == lap + 10);
+    CHECK_FALSE(ring.try_pop().has_value());
+  }
+}
+
+TEST_CASE("mpmc_ring threads", "[mpmc_ring]") {  // cppcheck-suppress[naming-functionName]
+  constexpr auto n_producers = std::size_t{3};
+  constexpr auto n_consumers = std::size_t{3};
+  constexpr auto per_producer = std::size_t{20'000};
+
+  auto ring = dlgr::mpmc_ring<std::size_t>(16);
+  auto received = std::vector<std::vector<std::size_t>>(n_consumers);
+
+  auto threads = std::vector<std::thread>();
+  for (auto producer = std::size_t{0}; producer < n_producers; ++producer) {
+    threads.emplace_back([&ring, producer] {
+      for (auto val = std::size_t{0}; val < per_producer; ++val) {
+        ring.push(producer * per_producer + val);
+      }
+    });
+  }
+  for (auto& out : received) {
+    threads.emplace_back([&ring, &out] {
+      for (auto iter = std::size_t{0}; iter < n_producers * per_producer / n_consumers; ++iter) {
+        out.push_back(ring.pop());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto all = std::vector<std::size_t>();
+  for (const auto& out : received) {
+    // Elements of one producer are seen in order by every consumer
+    for (auto producer = std::size_t{0}; producer < n_producers; ++producer) {
+      auto own = std::vector<std::size_t>();
+      std::ranges::copy_if(out, std::back_inserter(own), [&](std::size_t val) {
+        return val / per_producer == producer;
+      });
+      CHECK(std::ranges::is_sorted(own));
+    }
+    all.insert(all.end(), out.begin(), out.end());
+  }
+
+  std::ranges::sort(all);
+  CHECK(all.size() == n_producers * per_producer);
+  CHECK(std::ranges::adjacent_find(all) == all.end());
+  CHECK(all.back() == n_producers * per_producer - 1);
+  CHECK_FALSE(ring.try_pop().has_value());
+}
+// NOLINTEND
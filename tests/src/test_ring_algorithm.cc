@@ -0,0 +1,194 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <ranges>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <dlgr/ring_algorithm.h>
+#include <dlgr/ring_view.h>
+
+namespace {
+
+using dlgr::ranges::ring_view;
+
+template <std::ranges::range RangeType>
+auto to_vector(RangeType&& range) {
+  using ValueType = std::ranges::range_value_t<RangeType>;
+  auto out = std::vector<ValueType>();
+  std::ranges::copy(std::forward<RangeType>(range), std::back_insert_iterator(out));
+  return out;
+}
+
+}  // namespace
+
+// NOLINTBEGIN
+TEST_CASE("ring copy", "[ring_algorithm]") {  // cppcheck-suppress[naming-functionName]
+  const auto init = std::vector{0.5F, 1.5F, 2.5F};
+  using value_type = decltype(init)::value_type;
+
+  SECTION("full range") {
+    auto rng = ring_view(init, 3);
+    auto out = std::vector<value_type>(rng.size());
+
+    auto result = dlgr::ranges::copy(rng, out.begin());
+
+    CHECK(result.in == rng.end());
+    CHECK(result.out == out.end());
+    CHECK(out == to_vector(rng));
+  }
+
+  SECTION("partial laps") {
+    auto rng = ring_view(init, 4) | std::views::drop(2) | std::views::take(7);
+    auto out = std::vector<value_type>();
+
+    dlgr::ranges::copy(rng, std::back_insert_iterator(out));
+
+    CHECK(out == std::vector<value_type>{2.5F, 0.5F, 1.5F, 2.5F, 0.5F, 1.5F, 2.5F});
+  }
+
+  SECTION("list") {
+    auto list = std::list{1, 2, 3};
+    auto out = std::vector<int>();
+
+    dlgr::ranges::copy(ring_view(list, 2), std::back_insert_iterator(out));
+
+    CHECK(out == std::vector{1, 2, 3, 1, 2, 3});
+  }
+
+  SECTION("empty") {
+    auto out = std::vector<value_type>();
+
+    dlgr::ranges::copy(ring_view(init, 0), std::back_insert_iterator(out));
+
+    CHECK(out.empty());
+  }
+}
+
+TEST_CASE("ring fill", "[ring_algorithm]") {  // cppcheck-suppress[naming-functionName]
+  auto init = std::vector{0, 1, 2, 3, 4};
+
+  auto rng = ring_view(init, 2) | std::views::drop(3) | std::views::take(3);
+  auto last = dlgr::ranges::fill(rng, 7);
+
+  CHECK(last == rng.end());
+  CHECK(init == std::vector{7, 1, 2, 7, 7});
+}
+
+TEST_CASE("ring for_each", "[ring_algorithm]") {  // cppcheck-suppress[naming-functionName]
+  auto init = std::vector{1, 2, 3};
+
+  SECTION("accumulate") {
+    auto rng = ring_view(init, 3);
+    auto sum = 0;
+    auto result = dlgr::ranges::for_each(rng, [&sum](int val) { sum += val; });
+
+    CHECK(sum == 18);
+    CHECK(result.in == rng.end());
+  }
+
+  SECTION("modify with projection") {
+    struct point {
+      int x = {};
+      int y = {};
+    };
+    auto points = std::vector<point>{{1, 2}, {3, 4}};
+
+    dlgr::ranges::for_each(ring_view(points, 2), [](int& val) { ++val; }, &point::y);
+
+    CHECK(points[0].y == 4);
+    CHECK(points[1].y == 6);
+  }
+}
+
+TEST_CASE("ring transform", "[ring_algorithm]") {  // cppcheck-suppress[naming-functionName]
+  const auto init = std::vector{1, 2, 3};
+
+  auto rng = ring_view(init, 3) | std::views::drop(1) | std::views::take(6);
+  auto out = std::vector<int>(6);
+
+  auto result = dlgr::ranges::transform(rng, out.begin(), [](int val) { return val * 10; });
+
+  CHECK(result.in == rng.end());
+  CHECK(result.out == out.end());
+  CHECK(out == std::vector{20, 30, 10, 20, 30, 10});
+}
+TEST_CASE("ring reduce", "[ring_algorithm]") {  // cppcheck-suppress[naming-functionName]
+  const auto init = std::vector{1, 2, 3, 4};
+
+  SECTION("closed form") {
+    const auto bound = GENERATE(0, 1, 2, 3, 1000);
+    auto rng = ring_view(init, bound);
+
+    CHECK(dlgr::ranges::ring_reduce(rng, 0) == std::accumulate(rng.begin(), rng.end(), 0));
+  }
+
+  SECTION("partial laps") {
+    const auto drop = GENERATE(0, 1, 3, 5);
+    const auto take = GENERATE(0, 2, 4, 9, 13);
+    auto rng = ring_view(init, 5) | std::views::drop(drop) | std::views::take(take);
+
+    CHECK(dlgr::ranges::ring_reduce(rng, 0) == std::accumulate(rng.begin(), rng.end(), 0));
+  }
+
+  SECTION("non commutative") {
+    const auto letters = std::vector<std::string>{"a", "b", "c"};
+    auto rng = ring_view(letters, 6) | std::views::drop(2);
+
+    auto concat = dlgr::ranges::ring_reduce(rng, std::string(">"));
+
+    CHECK(concat == std::accumulate(rng.begin(), rng.end(), std::string(">")));
+  }
+
+  SECTION("doubling") {
+    const auto bound = GENERATE(1, 2, 5, 8, 13);
+    auto muls = 0;
+    auto mul = [&muls](long lhs, long rhs) {
+      ++muls;
+      return lhs * rhs;
+    };
+    const auto twos = std::vector<long>{2};
+
+    CHECK(dlgr::ranges::ring_reduce(ring_view(twos, bound), 1L, mul) == (1L << bound));
+    CHECK(muls <= 2 * 4 + 2);
+  }
+}
+
+TEST_CASE("ring count", "[ring_algorithm]") {  // cppcheck-suppress[naming-functionName]
+  const auto init = std::vector{1, 2, 1, 3, 1};
+  const auto drop = GENERATE(0, 2, 4);
+  auto rng = ring_view(init, 1'000) | std::views::drop(drop);
+
+  CHECK(dlgr::ranges::ring_count(rng, 1) == std::ranges::count(rng, 1));
+  CHECK(dlgr::ranges::ring_count(ring_view(init, 0), 1) == 0);
+
+  auto is_odd = [](int val) { return val % 2 != 0; };
+  CHECK(dlgr::ranges::ring_count_if(rng, is_odd) == std::ranges::count_if(rng, is_odd));
+  CHECK(dlgr::ranges::ring_count_if(rng, is_odd, [](int val) { return val + 1; })
+        == std::ranges::count(rng, 2));
+}
+
+TEST_CASE("ring minmax", "[ring_algorithm]") {  // cppcheck-suppress[naming-functionName]
+  using pair_type = std::pair<int, int>;
+  const auto init = std::vector<pair_type>{{3, 0}, {1, 1}, {5, 2}, {1, 3}, {5, 4}, {2, 5}};
+  const auto drop = GENERATE(0, 1, 2, 4);
+  const auto take = GENERATE(1, 3, 5, 8, 20);
+  auto rng = ring_view(init, 4) | std::views::drop(drop) | std::views::take(take);
+
+  auto expected = std::ranges::minmax(rng, {}, &pair_type::first);
+  auto result = dlgr::ranges::ring_minmax(rng, {}, &pair_type::first);
+
+  CHECK(result.min == expected.min);
+  CHECK(result.max == expected.max);
+  CHECK(dlgr::ranges::ring_minmax(rng, std::ranges::greater(), &pair_type::first).min
+        == std::ranges::minmax(rng, std::ranges::greater(), &pair_type::first).min);
+}
+// NOLINTEND
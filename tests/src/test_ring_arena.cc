@@ -0,0 +1,170 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory_resource>
+#include <new>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <dlgr/ring_arena.h>
+
+namespace {
+
+using dlgr::ring_arena;
+
+auto is_aligned(const void* ptr, std::size_t alignment) -> bool {
+  return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+}  // namespace
+
+// NOLINTBEGIN
+TEST_CASE("ring_arena fifo", "[ring_arena]") {  // cppcheck-suppress[naming-functionName]
+  // Room for four blocks of one header and 48 bytes each
+  auto arena = ring_arena(256);
+  CHECK(arena.capacity() == 256);
+  CHECK(arena.empty());
+
+  auto blocks = std::deque<void*>();
+  for (auto idx = 0; idx < 4; ++idx) {
+    blocks.push_back(arena.try_allocate(48));
+    REQUIRE(blocks.back() != nullptr);
+    CHECK(is_aligned(blocks.back(), ring_arena::block_alignment));
+  }
+  CHECK(arena.used() == 256);
+  CHECK(arena.try_allocate(1) == nullptr);
+  CHECK_THROWS_AS(arena.allocate(1), std::bad_alloc);
+
+  // Blocks are handed out one after another, and freed ones are reused in turn
+  for (auto round = 0; round < 10; ++round) {
+    auto* oldest = blocks.front();
+    blocks.pop_front();
+    arena.deallocate(oldest);
+    CHECK(arena.used() == 192);
+
+    auto* block = arena.try_allocate(48);
+    CHECK(block == oldest);
+    blocks.push_back(block);
+  }
+
+  for (auto* block : blocks) {
+    arena.deallocate(block);
+  }
+  CHECK(arena.empty());
+}
+
+TEST_CASE("ring_arena out of order", "[ring_arena]") {  // cppcheck-suppress[naming-functionName]
+  auto arena = ring_arena(256);
+  auto* first = arena.allocate(48);
+  auto* second = arena.allocate(48);
+  auto* third = arena.allocate(48);
+
+  // Freeing a block in the middle only marks it
+  arena.deallocate(second);
+  CHECK(arena.used() == 192);
+
+  // The tail goes past every freed block once the oldest one is freed
+  arena.deallocate(first);
+  CHECK(arena.used() == 64);
+
+  arena.deallocate(third);
+  CHECK(arena.empty());
+
+  // An empty arena starts over from its beginning
+  CHECK(arena.allocate(48) == first);
+}
+
+TEST_CASE("ring_arena wrap", "[ring_arena]") {  // cppcheck-suppress[naming-functionName]
+  auto arena = ring_arena(256);
+  auto* first = arena.allocate(48);
+  auto* second = arena.allocate(128);
+  arena.deallocate(first);
+
+  // 48 bytes are left at the end, too few, so the block goes to the front behind a skip block
+  CHECK(arena.try_allocate(96) == nullptr);
+  auto* third = arena.allocate(48);
+  CHECK(third == first);
+  CHECK(arena.used() == 256);
+
+  // Freeing the block before the skip block reclaims the skip block as well
+  arena.deallocate(second);
+  CHECK(arena.used() == 64);
+  arena.deallocate(third);
+  CHECK(arena.empty());
+}
+
+TEST_CASE("ring_arena alignment", "[ring_arena]") {  // cppcheck-suppress[naming-functionName]
+  auto arena = ring_arena(4096);
+  auto blocks = std::vector<void*>();
+  for (auto alignment : {1, 8, 16, 32, 64, 256}) {
+    auto* block = arena.allocate(3, static_cast<std::size_t>(alignment));
+    CHECK(is_aligned(block, static_cast<std::size_t>(alignment)));
+    blocks.push_back(block);
+  }
+  for (auto* block : blocks) {
+    arena.deallocate(block);
+  }
+  CHECK(arena.empty());
+}
+
+TEST_CASE("ring_arena random frees", "[ring_arena]") {  // cppcheck-suppress[naming-functionName]
+  auto arena = ring_arena(1 << 14);
+  auto gen = std::mt19937(42);
+  auto live = std::deque<std::pair<std::byte*, std::size_t>>();
+
+  for (auto step = 0; step < 100'000; ++step) {
+    const auto size = std::uniform_int_distribution<std::size_t>(1, 300)(gen);
+    auto* block = static_cast<std::byte*>(arena.try_allocate(size));
+    if (block != nullptr) {
+      std::memset(block, static_cast<int>(size % 256), size);
+      live.emplace_back(block, size);
+    }
+
+    // Mostly the oldest one, sometimes one from the middle
+    if (block == nullptr || live.size() > 32) {
+      const auto pick = std::uniform_int_distribution<std::size_t>(0, 7)(gen) == 0
+                            ? live.size() / 2
+                            : std::size_t{0};
+      const auto [freed, freed_size] = live[pick];
+      live.erase(live.begin() + static_cast<std::ptrdiff_t>(pick));
+
+      for (auto idx = std::size_t{0}; idx < freed_size; ++idx) {
+        REQUIRE(freed[idx] == static_cast<std::byte>(freed_size % 256));
+      }
+      arena.deallocate(freed);
+    }
+  }
+
+  for (auto [block, size] : live) {
+    arena.deallocate(block);
+  }
+  CHECK(arena.empty());
+}
+
+TEST_CASE("ring_arena_resource", "[ring_arena]") {  // cppcheck-suppress[naming-functionName]
+  auto arena = ring_arena(4096);
+  auto resource = dlgr::ring_arena_resource(arena);
+  auto other_resource = dlgr::ring_arena_resource(arena);
+  CHECK(resource.is_equal(other_resource));
+  CHECK_FALSE(resource.is_equal(*std::pmr::new_delete_resource()));
+
+  {
+    auto messages = std::pmr::vector<std::pmr::string>(&resource);
+    for (auto idx = 0; idx < 10; ++idx) {
+      messages.emplace_back("message number " + std::to_string(idx) + " is long enough");
+    }
+    CHECK(messages[7] == "message number 7 is long enough");
+    CHECK_FALSE(arena.empty());
+  }
+  CHECK(arena.empty());
+
+  CHECK_THROWS_AS(resource.allocate(8192), std::bad_alloc);
+}
+// NOLINTEND
@@ -0,0 +1,290 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include <dlgr/ring_algorithm.h>
+#include <dlgr/ring_buffer.h>
+
+namespace {
+
+using dlgr::ring_buffer;
+
+template <std::ranges::range RangeType>
+auto to_vector(RangeType&& range) {
+  using ValueType = std::ranges::range_value_t<RangeType>;
+  auto out = std::vector<ValueType>();
+  std::ranges::copy(std::forward<RangeType>(range), std::back_insert_iterator(out));
+  return out;
+}
+
+template <class ValueType>
+struct counting_allocator {
+  using value_type = ValueType;
+
+  counting_allocator() = default;
+
+  explicit counting_allocator(std::size_t* allocations) : allocations_(allocations) {}
+
+  template <class OtherType>
+  counting_allocator(const counting_allocator<OtherType>& other)  // NOLINT(runtime/explicit)
+      : allocations_(other.allocations_) {}
+
+  auto allocate(std::size_t count) -> ValueType* {
+    ++*allocations_;
+    return std::allocator<ValueType>().allocate(count);
+  }
+
+  auto deallocate(ValueType* ptr, std::size_t count) -> void {
+    std::allocator<ValueType>().deallocate(ptr, count);
+  }
+
+  auto operator==(const counting_allocator&) const -> bool = default;
+
+  std::size_t* allocations_ = nullptr;
+};
+
+}  // namespace
+
+// NOLINTBEGIN
+TEST_CASE("ring_buffer concepts", "[ring_buffer]") {  // cppcheck-suppress[naming-functionName]
+  using buffer_type = ring_buffer<int>;
+
+  STATIC_CHECK(std::ranges::random_access_range<buffer_type>);
+  STATIC_CHECK(std::ranges::random_access_range<const buffer_type>);
+  STATIC_CHECK(std::ranges::common_range<buffer_type>);
+  STATIC_CHECK(std::ranges::output_range<buffer_type, int>);
+  STATIC_CHECK(!std::ranges::output_range<const buffer_type, int>);
+  STATIC_CHECK(dlgr::ranges::ring_segmented_range<buffer_type>);
+  STATIC_CHECK(
+      std::same_as<buffer_type::iterator,
+                   dlgr::ranges::ring_view<std::span<int>, std::size_t>::iterator_type>);
+}
+
+TEST_CASE("ring_buffer reject", "[ring_buffer]") {  // cppcheck-suppress[naming-functionName]
+  auto buf = ring_buffer<int>(3);
+
+  CHECK(buf.empty());
+  CHECK(buf.capacity() == 3);
+
+  CHECK(buf.push_back(1));
+  CHECK(buf.push_back(2));
+  CHECK(buf.push_back(3));
+  CHECK(buf.full());
+  CHECK_FALSE(buf.push_back(4));
+  CHECK(to_vector(buf) == std::vector{1, 2, 3});
+
+  buf.pop_front();
+  CHECK(buf.push_back(4));
+  CHECK(to_vector(buf) == std::vector{2, 3, 4});
+  CHECK(buf.front() == 2);
+  CHECK(buf.back() == 4);
+  CHECK(buf[1] == 3);
+  CHECK(buf.end() - buf.begin() == 3);
+
+  buf.pop_back();
+  CHECK(to_vector(buf) == std::vector{2, 3});
+}
+
+TEST_CASE("ring_buffer overwrite", "[ring_buffer]") {  // cppcheck-suppress[naming-functionName]
+  auto buf = ring_buffer<int, std::allocator<int>, dlgr::ring_buffer_overwrite_t>(3);
+
+  for (auto val : std::views::iota(0, 10)) {
+    CHECK(buf.push_back(val));
+  }
+
+  CHECK(buf.full());
+  CHECK(to_vector(buf) == std::vector{7, 8, 9});
+  CHECK(to_vector(buf | std::views::reverse) == std::vector{9, 8, 7});
+}
+
+TEST_CASE("ring_buffer overwrite from itself", "[ring_buffer]") {  // cppcheck-suppress[naming-functionName]
+  // Long enough to live on the heap, so reading a destroyed string would show
+  const auto long_string = [](char chr) { return std::string(40, chr); };
+  auto buf = ring_buffer<std::string, std::allocator<std::string>,
+                         dlgr::ring_buffer_overwrite_t>(3);
+  for (auto chr : {'a', 'b', 'c'}) {
+    buf.push_back(long_string(chr));
+  }
+
+  SECTION("push_back") {
+    CHECK(buf.push_back(buf.front()));
+    CHECK(to_vector(buf) == std::vector{long_string('b'), long_string('c'), long_string('a')});
+
+    CHECK(buf.emplace_back(buf[0]));
+    CHECK(to_vector(buf) == std::vector{long_string('c'), long_string('a'), long_string('b')});
+  }
+
+  SECTION("push_n") {
+    CHECK(buf.push_n(buf.begin(), 2) == 2);
+    CHECK(to_vector(buf) == std::vector{long_string('c'), long_string('a'), long_string('b')});
+
+    CHECK(buf.push_n(std::make_reverse_iterator(buf.end()), 3) == 3);
+    CHECK(to_vector(buf) == std::vector{long_string('b'), long_string('a'), long_string('c')});
+
+    // Contiguous input, checked by its bounds
+    auto expected = to_vector(buf);
+    const auto span = buf.as_spans()[0];
+    expected.insert(expected.end(), span.begin(), span.end());
+    expected.erase(expected.begin(), expected.end() - 3);
+    CHECK(buf.push_n(span.begin(), span.size()) == span.size());
+    CHECK(to_vector(buf) == expected);
+  }
+}
+
+TEST_CASE("ring_buffer pow2 capacity", "[ring_buffer]") {  // cppcheck-suppress[naming-functionName]
+  auto buf = ring_buffer<int>(dlgr::ring_buffer_pow2_capacity, 5);
+
+  CHECK(buf.capacity() == 8);
+
+  for (auto lap = 0; lap < 3; ++lap) {
+    for (auto val : std::views::iota(0, 6)) {
+      CHECK(buf.push_back(val + lap));
+    }
+    CHECK(to_vector(buf) == std::vector{lap, lap + 1, lap + 2, lap + 3, lap + 4, lap + 5});
+    buf.clear();
+  }
+}
+
+TEST_CASE("ring_buffer bulk", "[ring_buffer]") {  // cppcheck-suppress[naming-functionName]
+  const auto init = std::vector{1, 2, 3, 4, 5, 6, 7};
+
+  SECTION("reject") {
+    auto buf = ring_buffer<int>(5);
+    CHECK(buf.push_n(init.begin(), 3) == 3);
+
+    auto out = std::vector<int>();
+    buf.pop_n(2, std::back_insert_iterator(out));
+    CHECK(out == std::vector{1, 2});
+
+    CHECK(buf.push_n(init.begin() + 3, 4) == 4);
+    CHECK(to_vector(buf) == std::vector{3, 4, 5, 6, 7});
+    CHECK(buf.push_n(init.begin(), 1) == 0);
+
+    const auto spans = buf.as_spans();
+    CHECK(spans[0].size() == 3);
+    CHECK(spans[1].size() == 2);
+    CHECK(to_vector(spans[0]) == std::vector{3, 4, 5});
+    CHECK(to_vector(spans[1]) == std::vector{6, 7});
+
+    out.clear();
+    buf.pop_n(10, std::back_insert_iterator(out));
+    CHECK(out == std::vector{3, 4, 5, 6, 7});
+    CHECK(buf.empty());
+  }
+
+  SECTION("overwrite") {
+    auto buf = ring_buffer<int, std::allocator<int>, dlgr::ring_buffer_overwrite_t>(4);
+    buf.push_back(0);
+
+    CHECK(buf.push_n(init.begin(), 5) == 5);
+    CHECK(to_vector(buf) == std::vector{2, 3, 4, 5});
+
+    CHECK(buf.push_n(init.begin(), init.size()) == init.size());
+    CHECK(to_vector(buf) == std::vector{4, 5, 6, 7});
+  }
+
+  SECTION("segmented algorithms") {
+    auto buf = ring_buffer<int>(4);
+    buf.push_n(init.begin(), 3);
+    auto popped = std::vector<int>();
+    buf.pop_n(2, std::back_insert_iterator(popped));
+    buf.push_n(init.begin() + 3, 3);
+
+    auto out = std::vector<int>(buf.size());
+    dlgr::ranges::copy(buf, out.begin());
+    CHECK(out == std::vector{3, 4, 5, 6});
+  }
+}
+
+TEST_CASE("ring_buffer lifetime", "[ring_buffer]") {  // cppcheck-suppress[naming-functionName]
+  auto tracker = std::make_shared<int>(0);
+
+  {
+    auto buf = ring_buffer<std::shared_ptr<int>, std::allocator<std::shared_ptr<int>>,
+                           dlgr::ring_buffer_overwrite_t>(3);
+    for (auto iter = 0; iter < 5; ++iter) {
+      buf.push_back(tracker);
+    }
+    CHECK(tracker.use_count() == 4);
+
+    buf.pop_front();
+    CHECK(tracker.use_count() == 3);
+
+    auto copy = buf;
+    CHECK(tracker.use_count() == 5);
+
+    auto moved = std::move(copy);
+    CHECK(tracker.use_count() == 5);
+
+    copy = moved;
+    CHECK(tracker.use_count() == 7);
+  }
+
+  CHECK(tracker.use_count() == 1);
+}
+
+TEST_CASE("ring_buffer copy and move", "[ring_buffer]") {  // cppcheck-suppress[naming-functionName]
+  auto buf = ring_buffer<std::string>(3);
+  buf.push_back("a");
+  buf.push_back("b");
+  buf.pop_front();
+  buf.emplace_back(2, 'c');
+  buf.emplace_back("d");
+
+  auto copy = buf;
+  CHECK(to_vector(copy) == std::vector<std::string>{"b", "cc", "d"});
+  CHECK(copy.capacity() == 3);
+
+  auto moved = std::move(buf);
+  CHECK(to_vector(moved) == std::vector<std::string>{"b", "cc", "d"});
+  CHECK(buf.empty());  // NOLINT(bugprone-use-after-move)
+  CHECK(buf.capacity() == 0);
+  CHECK_FALSE(buf.push_back("e"));
+
+  buf = copy;
+  CHECK(to_vector(buf) == std::vector<std::string>{"b", "cc", "d"});
+
+  swap(buf, moved);
+  moved.pop_front();
+  CHECK(to_vector(moved) == std::vector<std::string>{"cc", "d"});
+  CHECK(to_vector(buf) == std::vector<std::string>{"b", "cc", "d"});
+}
+
+TEST_CASE("ring_buffer allocation", "[ring_buffer]") {  // cppcheck-suppress[naming-functionName]
+  auto allocations = std::size_t{0};
+  auto buf = ring_buffer<int, counting_allocator<int>, dlgr::ring_buffer_overwrite_t>(
+      5, counting_allocator<int>(&allocations));
+
+  for (auto val : std::views::iota(0, 100)) {
+    buf.push_back(val);
+    if (val % 3 == 0) {
+      buf.pop_front();
+    }
+  }
+
+  CHECK(allocations == 1);
+}
+
+TEST_CASE("ring_buffer constexpr", "[ring_buffer]") {  // cppcheck-suppress[naming-functionName]
+  constexpr auto sum = [] {
+    auto buf = ring_buffer<int, std::allocator<int>, dlgr::ring_buffer_overwrite_t>(3);
+    for (auto val : std::views::iota(1, 6)) {
+      buf.push_back(val);
+    }
+    auto res = 0;
+    for (auto val : buf) {
+      res += val;
+    }
+    return res;
+  }();
+
+  STATIC_CHECK(sum == 12);
+}
+// NOLINTEND
@@ -0,0 +1,173 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <dlgr/ring_parallel.h>
+#include <dlgr/ring_view.h>
+
+namespace {
+
+using dlgr::ranges::parallel_options;
+using dlgr::ranges::ring_view;
+
+}  // namespace
+
+// NOLINTBEGIN
+TEST_CASE("ring parallel_for_each", "[ring_parallel]") {  // cppcheck-suppress[naming-functionName]
+  const auto threads = GENERATE(std::size_t{1}, std::size_t{2}, std::size_t{3}, std::size_t{8});
+  const auto options = parallel_options{.threads = threads, .min_chunk_size = 1};
+
+  auto base = std::vector<std::size_t>(10);
+  std::iota(base.begin(), base.end(), std::size_t{0});
+  auto rng = ring_view(base, 7);
+
+  // Laps visit every base element many times, so the calls must be safe for the same element
+  auto calls = std::vector<std::atomic<int>>(base.size());
+  auto count_call = [&calls](std::size_t index) { calls[index].fetch_add(1); };
+  auto counts = [&calls] {
+    auto res = std::vector<int>();
+    for (const auto& count : calls) {
+      res.push_back(count.load());
+    }
+    return res;
+  };
+
+  SECTION("whole") {
+    dlgr::ranges::parallel_for_each(rng, count_call, options);
+
+    CHECK(counts() == std::vector<int>(10, 7));
+  }
+
+  SECTION("partial laps") {
+    auto sub = std::ranges::subrange(rng.begin() + 3, rng.end() - 4);
+    dlgr::ranges::parallel_for_each(sub, count_call, options);
+
+    CHECK(counts() == std::vector{6, 6, 6, 7, 7, 7, 6, 6, 6, 6});
+  }
+
+  SECTION("empty") {
+    dlgr::ranges::parallel_for_each(ring_view(base, 0), count_call, options);
+
+    CHECK(counts() == std::vector<int>(10));
+  }
+}
+
+TEST_CASE("ring parallel_transform", "[ring_parallel]") {  // cppcheck-suppress[naming-functionName]
+  const auto threads = GENERATE(std::size_t{1}, std::size_t{4}, std::size_t{16});
+  const auto options = parallel_options{.threads = threads, .min_chunk_size = 1};
+
+  auto init = std::vector<int>(13);
+  std::iota(init.begin(), init.end(), 0);
+  const auto rng = ring_view(init, 5);
+
+  auto out = std::vector<int>(rng.size());
+  auto last = dlgr::ranges::parallel_transform(
+      rng, out.begin(), [](int val) { return val * 2; }, options);
+
+  auto expected = std::vector<int>();
+  for (auto val : rng) {
+    expected.push_back(val * 2);
+  }
+
+  CHECK(last == out.end());
+  CHECK(out == expected);
+}
+
+TEST_CASE("ring parallel many laps", "[ring_parallel]") {  // cppcheck-suppress[naming-functionName]
+  const auto threads = GENERATE(std::size_t{1}, std::size_t{3}, std::size_t{8});
+  const auto options = parallel_options{.threads = threads, .min_chunk_size = 1};
+
+  auto init = std::vector<int>{1, 2, 3};
+  const auto rng = ring_view(init, 100'000);
+  auto sub = std::ranges::subrange(rng.begin() + 2, rng.end() - 1);
+
+  SECTION("chunk bounds") {
+    auto out = std::vector<int>(sub.size());
+    dlgr::ranges::parallel_transform(sub, out.begin(), [](int val) { return val; }, options);
+
+    auto expected = std::vector<int>();
+    for (auto val : sub) {
+      expected.push_back(val);
+    }
+    CHECK(out == expected);
+    CHECK(dlgr::ranges::parallel_reduce(sub, 0L, std::plus<>(), options) == 600'000L - 6);
+  }
+
+  SECTION("one copy of fun per chunk") {
+    // The copy counts its calls, so its results only start over where a chunk does
+    auto out = std::vector<long>(sub.size());
+    dlgr::ranges::parallel_transform(
+        sub, out.begin(), [calls = 0L](int) mutable { return calls++; }, options);
+
+    auto restarts = std::size_t{0};
+    for (auto idx = std::size_t{1}; idx < out.size(); ++idx) {
+      if (out[idx] != out[idx - 1] + 1) {
+        CHECK(out[idx] == 0);
+        ++restarts;
+      }
+    }
+    CHECK(out.front() == 0);
+    CHECK(restarts == threads - 1);
+  }
+
+  SECTION("one copy of op per chunk") {
+    // Every copy adds one on its first call only, so the sum counts the copies called, the
+    // original one included, which combines the partial results
+    const auto zeros = std::vector<int>(3);
+    auto first_calls = [calls = 0L](long acc, long val) mutable {
+      return acc + val + (calls++ == 0 ? 1 : 0);
+    };
+
+    CHECK(dlgr::ranges::parallel_reduce(ring_view(zeros, 100'000), 0L, first_calls, options)
+          == static_cast<long>(threads) + 1);
+  }
+}
+
+TEST_CASE("ring parallel_reduce", "[ring_parallel]") {  // cppcheck-suppress[naming-functionName]
+  const auto threads = GENERATE(std::size_t{1}, std::size_t{3}, std::size_t{7});
+  const auto options = parallel_options{.threads = threads, .min_chunk_size = 1};
+
+  auto init = std::vector<std::string>{"a", "b", "c", "d"};
+  const auto rng = ring_view(init, 3);
+  auto sub = std::ranges::subrange(rng.begin() + 1, rng.end());
+
+  SECTION("non commutative") {
+    auto concat = dlgr::ranges::parallel_reduce(sub, std::string(">"), std::plus<>(), options);
+
+    CHECK(concat == ">bcdabcdabcd");
+  }
+
+  SECTION("sum") {
+    auto values = std::vector<long>(1'000);
+    std::iota(values.begin(), values.end(), 1L);
+
+    auto sum = dlgr::ranges::parallel_reduce(ring_view(values, 10), 0L, std::plus<>(), options);
+
+    CHECK(sum == 10 * 500'500L);
+  }
+}
+
+TEST_CASE("ring parallel exceptions", "[ring_parallel]") {  // cppcheck-suppress[naming-functionName]
+  const auto options = parallel_options{.threads = 4, .min_chunk_size = 1};
+  auto init = std::vector<int>{1, 2, 3};
+
+  CHECK_THROWS_AS(dlgr::ranges::parallel_for_each(
+                      ring_view(init, 10),
+                      [](int val) {
+                        if (val == 3) {
+                          throw std::runtime_error("three");
+                        }
+                      },
+                      options),
+                  std::runtime_error);
+}
+// NOLINTEND
@@ -0,0 +1,141 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include <dlgr/ring_simd.h>
+#include <dlgr/ring_view.h>
+
+namespace {
+
+using dlgr::ranges::ring_view;
+
+// Small integral values, so floating point sums are exact in any order
+template <class ValueType>
+auto make_values(std::size_t size) -> std::vector<ValueType> {
+  auto out = std::vector<ValueType>(size);
+  for (auto idx = std::size_t{0}; idx < size; ++idx) {
+    out[idx] = static_cast<ValueType>((idx * 7 + 3) % 23) - ValueType{5};
+  }
+  return out;
+}
+
+auto supported_isas() -> std::vector<dlgr::simd_isa> {
+  auto out = std::vector{dlgr::simd_isa::scalar};
+  if (dlgr::detected_simd_isa() >= dlgr::simd_isa::vector128) {
+    out.push_back(dlgr::simd_isa::vector128);
+  }
+  if (dlgr::detected_simd_isa() >= dlgr::simd_isa::avx2) {
+    out.push_back(dlgr::simd_isa::avx2);
+  }
+  return out;
+}
+
+}  // namespace
+
+// NOLINTBEGIN
+TEMPLATE_TEST_CASE("ring simd", "[ring_simd]", float, double, std::int32_t, std::int8_t) {
+  const auto isa = GENERATE(from_range(supported_isas()));
+  const auto base_size = GENERATE(std::size_t{1}, std::size_t{5}, std::size_t{67});
+  const auto drop = GENERATE(0, 3);
+  const auto take = GENERATE(1, 40, 150);
+
+  const auto base = make_values<TestType>(base_size);
+  auto rng = ring_view(base, 4) | std::views::drop(drop) | std::views::take(take);
+  const auto expected = std::vector<TestType>(rng.begin(), rng.end());
+
+  SECTION("reduce") {
+    const auto sum = std::accumulate(expected.begin(), expected.end(), TestType{},
+                                     [](TestType lhs, TestType rhs) -> TestType {
+                                       return static_cast<TestType>(lhs + rhs);
+                                     });
+
+    CHECK(dlgr::ranges::simd_reduce(rng, isa) == sum);
+  }
+
+  SECTION("dot") {
+    const auto other = make_values<TestType>(expected.size());
+    const auto dot = std::inner_product(
+        expected.begin(), expected.end(), other.begin(), TestType{},
+        [](TestType lhs, TestType rhs) -> TestType { return static_cast<TestType>(lhs + rhs); },
+        [](TestType lhs, TestType rhs) -> TestType { return static_cast<TestType>(lhs * rhs); });
+
+    CHECK(dlgr::ranges::simd_dot(rng, other, isa) == dot);
+  }
+
+  SECTION("min max") {
+    CHECK(dlgr::ranges::simd_min(rng, isa) == std::ranges::min(expected));
+    CHECK(dlgr::ranges::simd_max(rng, isa) == std::ranges::max(expected));
+  }
+
+  SECTION("transform") {
+    auto out = std::vector<TestType>(expected.size());
+    auto twice = [](auto val) { return val + val; };
+
+    auto last = dlgr::ranges::simd_transform(rng, out.begin(), twice, isa);
+
+    CHECK(last == out.end());
+    for (auto idx = std::size_t{0}; idx < out.size(); ++idx) {
+      CHECK(out[idx] == static_cast<TestType>(expected[idx] + expected[idx]));
+    }
+  }
+}
+
+TEST_CASE("ring simd scalar function", "[ring_simd]") {  // cppcheck-suppress[naming-functionName]
+  const auto base = make_values<float>(100);
+  auto out = std::vector<float>(300);
+
+  dlgr::ranges::simd_transform(ring_view(base, 3), out.begin(),
+                               [](float val) { return std::max(val, 0.0F); });
+
+  for (auto idx = std::size_t{0}; idx < out.size(); ++idx) {
+    CHECK(out[idx] == std::max(base[idx % base.size()], 0.0F));
+  }
+}
+
+TEST_CASE("ring simd many laps", "[ring_simd]") {  // cppcheck-suppress[naming-functionName]
+  const auto base = make_values<std::int32_t>(33);
+  const auto rng = ring_view(base, 100'000);
+
+  CHECK(dlgr::ranges::simd_reduce(rng) == 100'000 * std::accumulate(base.begin(), base.end(), 0));
+  CHECK(dlgr::ranges::simd_min(rng) == std::ranges::min(base));
+}
+
+TEST_CASE("ring simd integer wrap", "[ring_simd]") {  // cppcheck-suppress[naming-functionName]
+  const auto isa = GENERATE(from_range(supported_isas()));
+
+  SECTION("reduce") {
+    // The whole laps alone go far past the range of the value type
+    const auto base = std::vector<std::int32_t>(35, std::numeric_limits<std::int32_t>::max() - 2);
+    const auto rng = ring_view(base, 100'000);
+
+    auto expected = std::uint32_t{0};
+    for (auto val : rng) {
+      expected += static_cast<std::uint32_t>(val);
+    }
+    CHECK(dlgr::ranges::simd_reduce(rng, isa) == static_cast<std::int32_t>(expected));
+  }
+
+  SECTION("dot") {
+    // Products of unsigned shorts overflow an int they would be promoted to
+    const auto base = std::vector<std::uint16_t>(37, std::uint16_t{65'535});
+    const auto rng = ring_view(base, 3);
+    const auto other = std::vector<std::uint16_t>(rng.size(), std::uint16_t{65'534});
+
+    auto expected = std::uint16_t{0};
+    for (auto val : rng) {
+      expected = static_cast<std::uint16_t>(expected + std::uint32_t{val} * 65'534U);
+    }
+    CHECK(dlgr::ranges::simd_dot(rng, std::span(other), isa) == expected);
+  }
+}
+// NOLINTEND
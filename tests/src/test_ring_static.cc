@@ -0,0 +1,87 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include <dlgr/ring_static.h>
+#include <dlgr/ring_view.h>
+
+namespace {
+
+using dlgr::ranges::ring_to_array;
+using dlgr::ranges::ring_view;
+using dlgr::ranges::static_ring_view;
+using dlgr::views::static_ring;
+
+constexpr auto schedule = std::array{3, 1, 4, 1, 5};
+constexpr int c_schedule[] = {2, 7, 1};  // NOLINT(*-avoid-c-arrays): C arrays are bases too
+
+}  // namespace
+
+// NOLINTBEGIN
+TEST_CASE("ring_to_array", "[ring_static]") {  // cppcheck-suppress[naming-functionName]
+  constexpr auto bounded = ring_to_array<10>(ring_view(schedule, 2));
+  STATIC_CHECK(bounded == std::array{3, 1, 4, 1, 5, 3, 1, 4, 1, 5});
+
+  constexpr auto unbounded = ring_to_array<7>(ring_view(schedule));
+  STATIC_CHECK(unbounded == std::array{3, 1, 4, 1, 5, 3, 1});
+
+  constexpr auto prefix = ring_to_array<4>(ring_view(c_schedule, 2));
+  STATIC_CHECK(prefix == std::array{2, 7, 1, 2});
+
+  constexpr auto empty = ring_to_array<0>(ring_view(schedule, 0));
+  STATIC_CHECK(empty.empty());
+
+  constexpr auto twice = [](int val) { return val * 2; };
+  constexpr auto transformed = ring_to_array<6>(ring_view(schedule) | std::views::transform(twice));
+  STATIC_CHECK(transformed == std::array{6, 2, 8, 2, 10, 6});
+}
+
+TEST_CASE("static_ring concepts", "[ring_static]") {  // cppcheck-suppress[naming-functionName]
+  using view_type = static_ring_view<schedule, 3>;
+  STATIC_CHECK(std::ranges::contiguous_range<view_type>);
+  STATIC_CHECK(std::ranges::common_range<view_type>);
+  STATIC_CHECK(std::ranges::sized_range<view_type>);
+  STATIC_CHECK(std::ranges::borrowed_range<view_type>);
+  STATIC_CHECK(std::ranges::view<view_type>);
+  STATIC_CHECK(!std::ranges::output_range<view_type, int>);
+
+  // The walk is over a plain array with its size in the type, which leaves nothing to check at
+  // run time
+  STATIC_CHECK(std::is_same_v<std::ranges::iterator_t<view_type>,
+                              typename std::array<int, 15>::const_iterator>);
+  STATIC_CHECK(std::is_same_v<typename view_type::table_type, std::array<int, 15>>);
+  STATIC_CHECK(std::is_convertible_v<const typename view_type::table_type&,
+                                     std::span<const int, 15>>);
+  STATIC_CHECK(std::is_empty_v<view_type>);
+}
+
+TEST_CASE("static_ring", "[ring_static]") {  // cppcheck-suppress[naming-functionName]
+  STATIC_CHECK(static_ring<schedule, 3>.size() == 15);
+  STATIC_CHECK(static_ring<schedule, 3>[12] == 4);
+  STATIC_CHECK(static_ring<schedule, 0>.empty());
+  STATIC_CHECK(static_ring<c_schedule, 2>.table() == std::array{2, 7, 1, 2, 7, 1});
+  STATIC_CHECK(&static_ring<schedule, 3>.base() == &schedule);
+  STATIC_CHECK(static_ring<schedule, 3>.bound() == 3);
+
+  const auto expected = std::vector<int>(ring_view(schedule, 3).begin(),
+                                         ring_view(schedule, 3).end());
+  CHECK(std::ranges::equal(static_ring<schedule, 3>, expected));
+  CHECK(std::ranges::equal(static_ring<schedule, 3> | std::views::reverse,
+                           expected | std::views::reverse));
+
+  auto sum = 0;
+  for (auto val : static_ring<schedule, 4>) {
+    sum += val;
+  }
+  CHECK(sum == 56);
+}
+// NOLINTEND
@@ -0,0 +1,196 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <forward_list>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <dlgr/ring_stride.h>
+#include <dlgr/ring_view.h>
+
+namespace {
+
+using dlgr::ranges::ring_stride_view;
+using dlgr::views::ring_stride;
+
+template <std::ranges::range RangeType>
+auto to_vector(RangeType&& range) {
+  using ValueType = std::ranges::range_value_t<RangeType>;
+  auto out = std::vector<ValueType>();
+  std::ranges::copy(std::forward<RangeType>(range), std::back_insert_iterator(out));
+  return out;
+}
+
+// Every stride-th element of bound laps of the base, walked one by one
+auto expected_stride(const std::vector<int>& base, std::size_t stride, std::size_t bound) {
+  auto out = std::vector<int>();
+  for (auto idx = std::size_t{0}; idx < base.size() * bound; idx += stride) {
+    out.push_back(base[idx % base.size()]);
+  }
+  return out;
+}
+
+}  // namespace
+
+// NOLINTBEGIN
+TEST_CASE("ring_stride concepts", "[ring_stride]") {  // cppcheck-suppress[naming-functionName]
+  using vector_type = decltype(std::declval<std::vector<int>&>() | ring_stride(3, 2));
+  STATIC_CHECK(std::ranges::random_access_range<vector_type>);
+  STATIC_CHECK(std::ranges::common_range<vector_type>);
+  STATIC_CHECK(std::ranges::sized_range<vector_type>);
+  STATIC_CHECK(std::ranges::random_access_range<const vector_type>);
+  STATIC_CHECK(std::ranges::borrowed_range<vector_type>);
+  STATIC_CHECK(std::ranges::output_range<vector_type, int>);
+
+  using unbounded_type = decltype(std::declval<std::vector<int>&>() | ring_stride(3));
+  STATIC_CHECK(std::ranges::random_access_range<unbounded_type>);
+  STATIC_CHECK(!std::ranges::common_range<unbounded_type>);
+  STATIC_CHECK(!std::ranges::sized_range<unbounded_type>);
+
+  using list_type = decltype(std::declval<std::list<int>&>() | ring_stride(3, 2));
+  STATIC_CHECK(std::ranges::forward_range<list_type>);
+  STATIC_CHECK(!std::ranges::bidirectional_range<list_type>);
+  STATIC_CHECK(std::ranges::sized_range<list_type>);
+
+  using forward_list_type = decltype(std::declval<std::forward_list<int>&>() | ring_stride(3, 2));
+  STATIC_CHECK(std::ranges::forward_range<forward_list_type>);
+  STATIC_CHECK(!std::ranges::sized_range<forward_list_type>);
+
+  STATIC_CHECK(!std::ranges::borrowed_range<decltype(std::vector<int>() | ring_stride(3, 2))>);
+}
+
+TEST_CASE("ring_stride bounded", "[ring_stride]") {  // cppcheck-suppress[naming-functionName]
+  const auto base_size = GENERATE(std::size_t{1}, 2, 5, 6, 12);
+  const auto stride = GENERATE(std::size_t{1}, 2, 3, 4, 6, 7, 13, 25);
+  const auto bound = GENERATE(std::size_t{0}, 1, 3, 7);
+
+  auto init = std::vector<int>(base_size);
+  std::ranges::generate(init, [val = 0]() mutable { return val += 11; });
+  const auto expected = expected_stride(init, stride, bound);
+
+  SECTION("vector") {
+    auto rng = init | ring_stride(static_cast<std::ptrdiff_t>(stride), bound);
+    CHECK(to_vector(rng) == expected);
+    CHECK(rng.size() == expected.size());
+    CHECK(std::ranges::distance(rng) == static_cast<std::ptrdiff_t>(expected.size()));
+  }
+
+  SECTION("list") {
+    const auto list = std::list(init.begin(), init.end());
+    auto rng = list | ring_stride(static_cast<std::ptrdiff_t>(stride), bound);
+    CHECK(to_vector(rng) == expected);
+    CHECK(rng.size() == expected.size());
+  }
+
+  SECTION("forward_list") {
+    const auto list = std::forward_list(init.begin(), init.end());
+    CHECK(to_vector(list | ring_stride(static_cast<std::ptrdiff_t>(stride), bound)) == expected);
+  }
+
+  SECTION("random access ops") {
+    const auto rng = ring_stride_view(std::span(init), static_cast<std::ptrdiff_t>(stride), bound);
+    const auto size = static_cast<std::ptrdiff_t>(expected.size());
+
+    for (auto idx = std::ptrdiff_t{0}; idx < size; ++idx) {
+      CHECK(rng.begin()[idx] == expected[static_cast<std::size_t>(idx)]);
+      CHECK(*(rng.end() - (size - idx)) == expected[static_cast<std::size_t>(idx)]);
+    }
+    CHECK(to_vector(rng | std::views::reverse)
+          == to_vector(expected | std::views::reverse));
+    CHECK(rng.end() - rng.begin() == size);
+  }
+}
+
+TEST_CASE("ring_stride unbounded", "[ring_stride]") {  // cppcheck-suppress[naming-functionName]
+  const auto init = std::vector{0, 11, 23, 24, 27, 31};
+
+  SECTION("sharding") {
+    auto rng = init | ring_stride(4);
+    CHECK(to_vector(rng | std::views::take(7)) == std::vector{0, 27, 23, 0, 27, 23, 0});
+    CHECK((init | ring_stride(4, dlgr::ranges::ring_view_unreachable_bound)).orbit() == 3);
+  }
+
+  SECTION("jumps") {
+    auto rng = init | ring_stride(5);
+    auto iter = rng.begin() + 1'000'003;
+    CHECK(*iter == init[1'000'003 * 5 % init.size()]);
+    CHECK(iter.base_offset() == 1'000'003 * 5 % 6);
+    CHECK(iter[-1'000'003] == 0);
+    iter -= 999'999;
+    CHECK(*iter == init[4 * 5 % init.size()]);
+    CHECK(iter - rng.begin() == 4);
+    CHECK(*--iter == init[3 * 5 % init.size()]);
+  }
+
+  SECTION("list") {
+    const auto list = std::list(init.begin(), init.end());
+    auto rng = list | ring_stride(9);
+    CHECK(to_vector(rng | std::views::take(5)) == std::vector{0, 24, 0, 24, 0});
+    CHECK(rng.orbit() == 2);
+  }
+}
+
+TEST_CASE("ring_stride empty base", "[ring_stride]") {  // cppcheck-suppress[naming-functionName]
+  const auto init = std::vector<int>();
+  const auto list = std::forward_list<int>();
+
+  SECTION("bounded") {
+    auto rng = init | ring_stride(3, 4);
+    CHECK(rng.begin() == rng.end());
+    CHECK(rng.empty());
+    CHECK(rng.size() == 0);
+    CHECK(to_vector(rng).empty());
+    CHECK(to_vector(list | ring_stride(3, 4)).empty());
+  }
+
+  SECTION("unbounded") {
+    auto rng = init | ring_stride(3);
+    CHECK(rng.begin() == rng.end());
+    CHECK(rng.end() == rng.begin());
+    CHECK(rng.empty());
+    CHECK(to_vector(rng).empty());
+    CHECK(to_vector(list | ring_stride(3)).empty());
+
+    // Any other base never ends
+    const auto one = std::vector{1};
+    CHECK_FALSE((one | ring_stride(3)).empty());
+  }
+}
+
+TEST_CASE("ring_stride orbit", "[ring_stride]") {  // cppcheck-suppress[naming-functionName]
+  const auto init = std::vector{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+
+  CHECK((init | ring_stride(1)).orbit() == 12);
+  CHECK((init | ring_stride(5)).orbit() == 12);
+  CHECK((init | ring_stride(8)).orbit() == 3);
+  CHECK((init | ring_stride(12)).orbit() == 1);
+  CHECK((init | ring_stride(30)).orbit() == 2);
+  CHECK((std::vector<int>() | ring_stride(3)).orbit() == 0);
+}
+
+TEST_CASE("ring_stride output range", "[ring_stride]") {  // cppcheck-suppress[naming-functionName]
+  auto init = std::vector{0, 0, 0, 0, 0, 0};
+  auto counter = 0;
+  for (auto& val : init | ring_stride(4, 2)) {
+    val += ++counter;
+  }
+  CHECK(init == std::vector{1, 0, 3, 0, 2, 0});
+}
+
+TEST_CASE("ring_stride bound overflow",
+          "[ring_stride]") {  // cppcheck-suppress[naming-functionName]
+  const auto init = std::vector{1, 2};
+  CHECK_THROWS_AS(init | ring_stride(1, std::numeric_limits<std::size_t>::max()),
+                  std::overflow_error);
+}
+// NOLINTEND
@@ -6,6 +6,7 @@
 #include <catch2/generators/catch_generators_random.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <deque>
 #include <forward_list>
@@ -13,6 +14,7 @@
 #include <list>
 #include <ostream>
 #include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -150,12 +152,13 @@ constexpr auto check_iter_value_with_shift(IterType iter, std::iter_difference_t
     CHECK(iter - iter_shifted == -shift);
   }
 
+  const auto origin = iter;
   iter += shift;
   check_iter_value(iter, expected_value);
   CHECK(iter[-shift] == origin_value);
   if constexpr (has_diff_op) {
-    CHECK(iter_shifted - iter == shift);
-    CHECK(iter - iter_shifted == -shift);
+    CHECK(iter - origin == shift);
+    CHECK(origin - iter == -shift);
     CHECK(iter == iter_shifted);
   }
 }
@@ -638,6 +641,289 @@ TEST_CASE("ring_view output range", "[ring_view]") {  // cppcheck-suppress[namin
   CHECK(to_vector(rng) == std::vector<value_type>{2, 3, 4, 5, 2, 3, 4, 5});
 }
 
+TEST_CASE("ring_view random access", "[ring_view]") {  // cppcheck-suppress[naming-functionName]
+  const auto init_size = GENERATE(std::size_t{1}, 2, 3, 4, 7, 8, 13, 16);
+  auto init = std::vector<std::size_t>(init_size);
+  std::ranges::copy(std::views::iota(std::size_t{0}, init_size), init.begin());
+
+  SECTION("ring(unbounded)") {
+    auto rng = init | ring();
+    check_random_access_ops(rng, init);
+  }
+
+  SECTION("ring(bound = 256)") {
+    auto rng = init | ring(256);
+    check_random_access_ops(rng | std::views::drop(128 * init_size), init);
+
+    const auto size = static_cast<std::ptrdiff_t>(rng.size());
+    CHECK(rng.end() - rng.begin() == size);
+    CHECK((rng.begin() + size) == rng.end());
+    CHECK((rng.end() - size) == rng.begin());
+  }
+
+  SECTION("base resized after construction") {
+    auto rng = init | ring(2);
+    init.push_back(init_size);
+
+    CHECK(rng.size() == 2 * (init_size + 1));
+    CHECK(rng.begin()[static_cast<std::ptrdiff_t>(init_size + 1)] == 0);
+    CHECK((rng.end() - 1)[0] == init_size);
+  }
+}
+
+TEST_CASE("ring_view segments", "[ring_view]") {  // cppcheck-suppress[naming-functionName]
+  using dlgr::ranges::ring_segments;
+
+  const auto init = std::vector{0, 11, 23, 24, 27};
+  using value_type = decltype(init)::value_type;
+
+  const auto to_vectors = [](auto&& segments) {
+    auto out = std::vector<std::vector<value_type>>();
+    for (auto&& segment : segments) {
+      out.push_back(to_vector(segment));
+    }
+    return out;
+  };
+
+  SECTION("full laps") {
+    auto rng = ring_view(init, 3);
+
+    using segments_type = decltype(rng.segments());
+    STATIC_CHECK(std::ranges::random_access_range<segments_type>);
+    STATIC_CHECK(std::ranges::contiguous_range<std::ranges::range_value_t<segments_type>>);
+
+    CHECK(std::ranges::size(rng.segments()) == 3);
+    CHECK(to_vectors(rng.segments()) == std::vector<std::vector<value_type>>{init, init, init});
+  }
+
+  SECTION("partial laps") {
+    auto rng = ring_view(init, 3);
+    auto first = rng.begin() + 3;
+    auto last = rng.end() - 4;
+
+    CHECK(to_vectors(ring_segments(first, last))
+          == std::vector<std::vector<value_type>>{{24, 27}, init, {0}});
+    CHECK(to_vectors(ring_segments(first, first + 1))
+          == std::vector<std::vector<value_type>>{{24}});
+    CHECK(to_vectors(ring_segments(first, rng.begin() + 5))
+          == std::vector<std::vector<value_type>>{{24, 27}});
+    CHECK(to_vectors(ring_segments(first, first)).empty());
+  }
+
+  SECTION("take -> drop") {
+    auto rng = ring_view(init, 2) | std::views::take(8) | std::views::drop(1);
+
+    CHECK(to_vectors(ring_segments(rng))
+          == std::vector<std::vector<value_type>>{{11, 23, 24, 27}, {0, 11, 23}});
+  }
+
+  SECTION("forward_list") {
+    auto list = std::forward_list{1, 2, 3};
+    auto rng = ring_view(list, 2);
+
+    CHECK(to_vectors(rng.segments()) == std::vector<std::vector<value_type>>{{1, 2, 3}, {1, 2, 3}});
+  }
+
+  SECTION("empty") {
+    CHECK(to_vectors(ring_view(std::vector<value_type>(), 5).segments()).empty());
+    CHECK(to_vectors(ring_view(init, 0).segments()).empty());
+  }
+}
+
+TEST_CASE("ring_view borrowed range", "[ring_view]") {  // cppcheck-suppress[naming-functionName]
+  const auto init = std::vector{0, 11, 23, 24, 27};
+  const auto span = std::span(init);
+
+  STATIC_CHECK(std::ranges::borrowed_range<decltype(ring_view(span, 2))>);
+  STATIC_CHECK(std::ranges::borrowed_range<decltype(ring_view(span))>);
+  STATIC_CHECK(std::ranges::borrowed_range<decltype(ring_view(std::string_view("abc"), 2))>);
+  STATIC_CHECK(std::ranges::borrowed_range<decltype(ring_view(init, 2))>);
+  STATIC_CHECK(!std::ranges::borrowed_range<decltype(ring_view(std::vector{1, 2}, 2))>);
+
+  SECTION("algorithms on temporaries") {
+    auto found = std::ranges::find(ring_view(span, 3) | std::views::drop(2), 11);
+    STATIC_CHECK(!std::is_same_v<decltype(found), std::ranges::dangling>);
+    CHECK(*found == 11);
+    CHECK(*++found == 23);
+
+    auto min = std::ranges::min_element(ring_view(span, 2));
+    CHECK(*min == 0);
+    CHECK(*(min + 5) == 0);
+  }
+
+  SECTION("segments of temporaries") {
+    auto segments = dlgr::ranges::ring_segments(ring_view(span, 2));
+
+    CHECK(std::ranges::size(segments) == 2);
+    CHECK(std::ranges::equal(*segments.begin(), init));
+  }
+}
+
+TEST_CASE("ring_view compact iterator", "[ring_view]") {  // cppcheck-suppress[naming-functionName]
+  using dlgr::ranges::ring_segments;
+
+  auto init = std::array{0, 11, 23, 24, 27};
+  const auto fixed = std::span(init);
+  const auto dynamic = std::span<int>(init);
+
+  auto rng = ring_view(fixed, 256);
+  auto reference_rng = ring_view(dynamic, 256);
+
+  STATIC_CHECK(sizeof(rng.begin()) == 16);
+  STATIC_CHECK(sizeof(ring_view(init, 2).begin()) == 16);
+  STATIC_CHECK(sizeof(std::as_const(rng).begin()) == 16);
+  STATIC_CHECK(sizeof(reference_rng.begin()) > 16);
+  STATIC_CHECK(sizeof(ring_view(fixed).begin()) > 16);
+
+  STATIC_CHECK(std::random_access_iterator<decltype(rng.begin())>);
+  STATIC_CHECK(std::ranges::common_range<decltype(rng)>);
+  STATIC_CHECK(std::ranges::borrowed_range<decltype(rng)>);
+  STATIC_CHECK(std::ranges::output_range<decltype(rng), int>);
+  STATIC_CHECK(std::is_convertible_v<decltype(rng.begin()), decltype(std::as_const(rng).begin())>);
+
+  SECTION("same elements as the generic iterator") {
+    CHECK(std::ranges::equal(rng, reference_rng));
+    CHECK(std::ranges::equal(rng | std::views::reverse, reference_rng | std::views::reverse));
+    CHECK(rng.size() == reference_rng.size());
+    CHECK(rng.end() - rng.begin() == reference_rng.end() - reference_rng.begin());
+  }
+
+  SECTION("random access ops") {
+    const auto init_vector = std::vector(init.begin(), init.end());
+    check_random_access_ops(rng | std::views::drop(128 * init.size()), init_vector);
+
+    auto iter = rng.begin() + 7;
+    CHECK(*iter == 23);
+    CHECK(iter[3] == 0);
+    CHECK(*(iter -= 6) == 11);
+    CHECK(*(3 + iter) == 27);
+    CHECK(iter - rng.begin() == 1);
+    CHECK(rng.begin() < iter);
+    CHECK((rng.end() - 1)[0] == 27);
+
+    *iter = 12;
+    CHECK(init[1] == 12);
+  }
+
+  SECTION("segments") {
+    const auto to_sizes = [](auto&& segments) {
+      auto out = std::vector<std::ptrdiff_t>();
+      for (auto&& segment : segments) {
+        out.push_back(std::ranges::distance(segment));
+      }
+      return out;
+    };
+
+    for (auto first : {0, 3, 5, 9}) {
+      for (auto last : {9, 10, 17, 20}) {
+        CHECK(to_sizes(ring_segments(rng.begin() + first, rng.begin() + last))
+              == to_sizes(ring_segments(reference_rng.begin() + first,
+                                        reference_rng.begin() + last)));
+      }
+    }
+    CHECK(std::ranges::empty(ring_segments(rng.begin() + 3, rng.begin() + 3)));
+    CHECK(std::ranges::size(rng.segments()) == 256);
+  }
+}
+
+TEST_CASE("ring_view for non-common bases", "[ring_view]") {  // cppcheck-suppress[naming-functionName]
+  SECTION("take_while") {
+    auto base = std::views::iota(0) | std::views::take_while([](int val) { return val < 4; });
+    STATIC_CHECK(!std::ranges::common_range<decltype(base)>);
+
+    auto rng = ring_view(base, 3);
+    STATIC_CHECK(std::ranges::forward_range<decltype(rng)>);
+    STATIC_CHECK(!std::ranges::bidirectional_range<decltype(rng)>);
+    STATIC_CHECK(std::ranges::common_range<decltype(rng)>);
+
+    CHECK(to_vector(rng) == std::vector{0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3});
+    CHECK(to_vector(base | ring() | std::views::take(6)) == std::vector{0, 1, 2, 3, 0, 1});
+    CHECK(std::ranges::distance(rng) == 12);
+  }
+
+  SECTION("null-terminated string") {
+    struct null_sentinel {
+      constexpr auto operator==(const char* ptr) const -> bool { return *ptr == '\0'; }
+    };
+
+    const char* str = "abc";
+    auto base = std::ranges::subrange(str, null_sentinel());
+
+    CHECK(to_vector(ring_view(base) | std::views::take(7)) == std::vector{'a', 'b', 'c', 'a', 'b',
+                                                                          'c', 'a'});
+
+    auto rng = ring_view(base, 2);
+    auto segments = std::vector<std::string>();
+    for (auto&& segment : rng.segments()) {
+      segments.emplace_back(segment.begin(), segment.end());
+    }
+    CHECK(segments == std::vector<std::string>{"abc", "abc"});
+    CHECK(std::ranges::empty(ring_view(std::ranges::subrange("", null_sentinel()), 5)));
+  }
+
+  SECTION("sized sentinel") {
+    auto init = std::vector{0, 11, 23, 24, 27};
+    auto base =
+        std::ranges::subrange(std::counted_iterator(init.begin(), 4), std::default_sentinel);
+    STATIC_CHECK(!std::ranges::common_range<decltype(base)>);
+
+    auto rng = ring_view(base, 3);
+    STATIC_CHECK(std::ranges::random_access_range<decltype(rng)>);
+    STATIC_CHECK(std::ranges::sized_range<decltype(rng)>);
+
+    CHECK(rng.size() == 12);
+    CHECK(rng.begin()[6] == 23);
+    CHECK(*(rng.end() - 1) == 24);
+    CHECK(to_vector(rng | std::views::reverse | std::views::take(5))
+          == std::vector{24, 23, 11, 0, 24});
+  }
+
+  SECTION("generated base") {
+    auto init = std::vector{1, 2, 3};
+    auto base = init | std::views::transform([](int val) { return val * 10; });
+
+    auto rng = ring_view(base, 2);
+    STATIC_CHECK(std::ranges::random_access_range<decltype(rng)>);
+    CHECK(rng.begin()[4] == 20);
+    CHECK(to_vector(rng) == std::vector{10, 20, 30, 10, 20, 30});
+  }
+}
+
+TEST_CASE("ring_view unchecked", "[ring_view]") {  // cppcheck-suppress[naming-functionName]
+  using dlgr::ranges::ring_view_unchecked;
+  using dlgr::ranges::ring_view_assume_contracts_t;
+
+  auto base = std::vector{0, 11, 23, 24, 27};
+
+  auto checked = ring_view(base, 3);
+  auto unchecked = ring_view(dlgr::ranges::ring_view_assume_contracts, base, 3);
+  STATIC_CHECK(std::is_same_v<decltype(unchecked),
+                              ring_view_unchecked<std::ranges::ref_view<std::vector<int>>,
+                                                  dlgr::ranges::ring_view_bound_t>>);
+  STATIC_CHECK(std::is_same_v<typename decltype(unchecked)::contract_policy,
+                              ring_view_assume_contracts_t>);
+  STATIC_CHECK(std::ranges::random_access_range<decltype(unchecked)>);
+  STATIC_CHECK(std::ranges::borrowed_range<decltype(unchecked)>);
+
+  CHECK(to_vector(unchecked) == to_vector(checked));
+  CHECK(to_vector(unchecked | std::views::reverse) == to_vector(checked | std::views::reverse));
+  CHECK(unchecked.end() - unchecked.begin() == 15);
+  CHECK(unchecked.begin()[12] == 23);
+  CHECK(*(unchecked.end() - 8) == 23);
+
+  auto unbounded = ring_view(dlgr::ranges::ring_view_assume_contracts, base);
+  CHECK(to_vector(unbounded | std::views::take(7)) == std::vector{0, 11, 23, 24, 27, 0, 11});
+
+  const auto list = std::list<int>(base.begin(), base.end());
+  const auto list_ring = ring_view_unchecked<std::ranges::ref_view<const std::list<int>>>(list);
+  CHECK(to_vector(list_ring | std::views::take(6)) == std::vector{0, 11, 23, 24, 27, 0});
+
+  const auto fixed = std::array{1, 2, 3};
+  const auto compact = ring_view(dlgr::ranges::ring_view_assume_contracts, fixed, 2);
+  CHECK(to_vector(compact) == std::vector{1, 2, 3, 1, 2, 3});
+  CHECK(std::ranges::distance(compact.segments()) == 2);
+}
+
 // TODO(tests): deduction guides, more bounded tests, other std views and algorithms,
 // kv-containers, iterator/sentinel concepts, big bounds, out of range, random access ops,
 // constexpr, noexcept, const iter
@@ -0,0 +1,158 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <dlgr/ring_view.h>
+#include <dlgr/ring_window.h>
+
+namespace {
+
+using dlgr::ranges::ring_view;
+
+template <std::ranges::range RangeType>
+auto to_vector(RangeType&& range) {
+  using ValueType = std::ranges::range_value_t<RangeType>;
+  auto out = std::vector<ValueType>();
+  std::ranges::copy(std::forward<RangeType>(range), std::back_insert_iterator(out));
+  return out;
+}
+
+template <std::ranges::range RangeType>
+auto windows_to_vectors(RangeType&& range) {
+  auto out = std::vector<std::vector<int>>();
+  for (auto&& window : range) {
+    out.push_back(to_vector(window));
+  }
+  return out;
+}
+
+}  // namespace
+
+// NOLINTBEGIN
+TEST_CASE("ring_window concepts", "[ring_window]") {  // cppcheck-suppress[naming-functionName]
+  using window_type = decltype(std::declval<std::vector<int>&>() | dlgr::views::ring(2)
+                               | dlgr::views::ring_window(2));
+
+  STATIC_CHECK(std::ranges::forward_range<window_type>);
+  STATIC_CHECK(std::ranges::view<window_type>);
+  STATIC_CHECK(std::ranges::sized_range<window_type>);
+  STATIC_CHECK(std::ranges::forward_range<const window_type>);
+  STATIC_CHECK(std::ranges::borrowed_range<window_type>);
+
+  using owning_type = decltype(std::vector<int>() | dlgr::views::ring(2)
+                               | dlgr::views::ring_window(2));
+  STATIC_CHECK(!std::ranges::borrowed_range<owning_type>);
+}
+
+TEST_CASE("ring_window bounded", "[ring_window]") {  // cppcheck-suppress[naming-functionName]
+  const auto init = std::vector{1, 2, 3};
+
+  SECTION("windows") {
+    auto windows = ring_view(init, 2) | dlgr::views::ring_window(3);
+
+    CHECK(windows.size() == 4);
+    CHECK(windows_to_vectors(windows)
+          == std::vector<std::vector<int>>{{1, 2, 3}, {2, 3, 1}, {3, 1, 2}, {1, 2, 3}});
+  }
+
+  SECTION("width of the whole range") {
+    auto windows = ring_view(init, 2) | dlgr::views::ring_window(6);
+
+    CHECK(windows.size() == 1);
+    CHECK(windows_to_vectors(windows) == std::vector<std::vector<int>>{{1, 2, 3, 1, 2, 3}});
+  }
+
+  SECTION("wider than the range") {
+    auto windows = ring_view(init, 1) | dlgr::views::ring_window(4);
+
+    CHECK(windows.empty());
+    CHECK(windows.size() == 0);
+    CHECK(windows.begin() == windows.end());
+  }
+
+  SECTION("list base") {
+    const auto list = std::list{1, 2};
+    auto windows = ring_view(list, 2) | dlgr::views::ring_window(2);
+
+    CHECK(windows_to_vectors(windows) == std::vector<std::vector<int>>{{1, 2}, {2, 1}, {1, 2}});
+  }
+}
+
+TEST_CASE("ring_window unbounded", "[ring_window]") {  // cppcheck-suppress[naming-functionName]
+  const auto init = std::vector{1, 2, 3};
+  auto windows = ring_view(init) | dlgr::views::ring_window(2) | std::views::take(5);
+
+  CHECK(windows_to_vectors(windows)
+        == std::vector<std::vector<int>>{{1, 2}, {2, 3}, {3, 1}, {1, 2}, {2, 3}});
+}
+
+TEST_CASE("window aggregates", "[ring_window]") {  // cppcheck-suppress[naming-functionName]
+  const auto init = std::vector{5, 1, 4, 2, 8, 3, 7};
+  constexpr auto width = 3;
+
+  auto sum = dlgr::window_sum<int>(width);
+  auto min = dlgr::window_min<int>(width);
+  auto max = dlgr::window_max<int>(width);
+
+  auto sums = std::vector<int>();
+  auto mins = std::vector<int>();
+  auto maxs = std::vector<int>();
+
+  // Check against a full walk of every window
+  auto expected_sums = std::vector<int>();
+  auto expected_mins = std::vector<int>();
+  auto expected_maxs = std::vector<int>();
+
+  auto rng = ring_view(init, 3);
+  for (auto val : rng) {
+    sum.push(val);
+    min.push(val);
+    max.push(val);
+    if (sum.full()) {
+      CHECK(min.full());
+      CHECK(max.full());
+      sums.push_back(sum.value());
+      mins.push_back(min.value());
+      maxs.push_back(max.value());
+    }
+  }
+
+  for (auto window : rng | dlgr::views::ring_window(width)) {
+    expected_sums.push_back(std::accumulate(window.begin(), window.end(), 0));
+    expected_mins.push_back(std::ranges::min(window));
+    expected_maxs.push_back(std::ranges::max(window));
+  }
+
+  CHECK(sums.size() == rng.size() - width + 1);
+  CHECK(sums == expected_sums);
+  CHECK(mins == expected_mins);
+  CHECK(maxs == expected_maxs);
+
+  SECTION("partial window") {
+    auto partial = dlgr::window_min<int>(4);
+    partial.push(3);
+    partial.push(5);
+
+    CHECK_FALSE(partial.full());
+    CHECK(partial.size() == 2);
+    CHECK(partial.value() == 3);
+  }
+
+  SECTION("equal values") {
+    auto ties = dlgr::window_max<int>(2);
+    for (auto val : {4, 4, 4, 1}) {
+      ties.push(val);
+    }
+
+    CHECK(ties.value() == 4);
+  }
+}
+// NOLINTEND
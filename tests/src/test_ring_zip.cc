@@ -0,0 +1,200 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <forward_list>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <dlgr/ring_view.h>
+#include <dlgr/ring_zip.h>
+
+namespace {
+
+using dlgr::ranges::ring_zip_view;
+using dlgr::views::ring_zip;
+
+template <std::ranges::range RangeType>
+auto to_vector(RangeType&& range) {
+  using ValueType = std::ranges::range_value_t<RangeType>;
+  auto out = std::vector<ValueType>();
+  std::ranges::copy(std::forward<RangeType>(range), std::back_insert_iterator(out));
+  return out;
+}
+
+auto make_base(std::size_t size, int step) {
+  auto out = std::vector<int>(size);
+  std::ranges::generate(out, [val = 0, step]() mutable { return val += step; });
+  return out;
+}
+
+// Tuples of bound periods of the bases, walked one by one
+auto expected_zip(const std::vector<int>& lhs, const std::vector<int>& rhs, std::size_t bound) {
+  auto out = std::vector<std::tuple<int, int>>();
+  if (lhs.empty() || rhs.empty()) {
+    return out;
+  }
+  const auto period = std::lcm(lhs.size(), rhs.size());
+  for (auto idx = std::size_t{0}; idx < period * bound; ++idx) {
+    out.emplace_back(lhs[idx % lhs.size()], rhs[idx % rhs.size()]);
+  }
+  return out;
+}
+
+}  // namespace
+
+// NOLINTBEGIN
+TEST_CASE("ring_zip concepts", "[ring_zip]") {  // cppcheck-suppress[naming-functionName]
+  using vector_type = decltype(ring_zip(std::size_t{2}, std::declval<std::vector<int>&>(),
+                                        std::declval<std::string&>()));
+  STATIC_CHECK(std::ranges::random_access_range<vector_type>);
+  STATIC_CHECK(std::ranges::common_range<vector_type>);
+  STATIC_CHECK(std::ranges::sized_range<vector_type>);
+  STATIC_CHECK(std::ranges::random_access_range<const vector_type>);
+  STATIC_CHECK(std::ranges::borrowed_range<vector_type>);
+  STATIC_CHECK(std::same_as<std::ranges::range_reference_t<vector_type>, std::tuple<int&, char&>>);
+  STATIC_CHECK(std::same_as<std::ranges::range_value_t<vector_type>, std::tuple<int, char>>);
+
+  using unbounded_type =
+      decltype(ring_zip(std::declval<std::vector<int>&>(), std::declval<std::string&>()));
+  STATIC_CHECK(std::ranges::random_access_range<unbounded_type>);
+  STATIC_CHECK(!std::ranges::common_range<unbounded_type>);
+  STATIC_CHECK(!std::ranges::sized_range<unbounded_type>);
+
+  using list_type = decltype(ring_zip(std::size_t{2}, std::declval<std::vector<int>&>(),
+                                      std::declval<std::list<int>&>()));
+  STATIC_CHECK(std::ranges::forward_range<list_type>);
+  STATIC_CHECK(!std::ranges::bidirectional_range<list_type>);
+  STATIC_CHECK(std::ranges::sized_range<list_type>);
+
+  using forward_list_type = decltype(ring_zip(std::size_t{2}, std::declval<std::vector<int>&>(),
+                                              std::declval<std::forward_list<int>&>()));
+  STATIC_CHECK(std::ranges::forward_range<forward_list_type>);
+  STATIC_CHECK(!std::ranges::sized_range<forward_list_type>);
+
+  STATIC_CHECK(!std::ranges::borrowed_range<decltype(ring_zip(std::size_t{2}, std::vector<int>(),
+                                                              std::vector<int>()))>);
+}
+
+TEST_CASE("ring_zip bounded", "[ring_zip]") {  // cppcheck-suppress[naming-functionName]
+  const auto lhs_size = GENERATE(std::size_t{0}, 1, 4, 7);
+  const auto rhs_size = GENERATE(std::size_t{1}, 6, 24);
+  const auto bound = GENERATE(std::size_t{0}, 1, 3);
+
+  const auto lhs = make_base(lhs_size, 11);
+  const auto rhs = make_base(rhs_size, 3);
+  const auto expected = expected_zip(lhs, rhs, bound);
+
+  SECTION("vector") {
+    const auto rng = ring_zip(bound, lhs, rhs);
+    CHECK(rng.size() == expected.size());
+    CHECK(to_vector(rng) == expected);
+    CHECK(std::ranges::distance(rng.begin(), rng.end())
+          == static_cast<std::ptrdiff_t>(expected.size()));
+    CHECK(to_vector(rng | std::views::reverse)
+          == to_vector(expected | std::views::reverse));
+  }
+
+  SECTION("list") {
+    const auto rhs_list = std::list<int>(rhs.begin(), rhs.end());
+    CHECK(to_vector(ring_zip(bound, lhs, rhs_list)) == expected);
+  }
+
+  SECTION("forward_list") {
+    const auto rhs_list = std::forward_list<int>(rhs.begin(), rhs.end());
+    CHECK(to_vector(ring_zip(bound, lhs, rhs_list)) == expected);
+  }
+}
+
+TEST_CASE("ring_zip seek", "[ring_zip]") {  // cppcheck-suppress[naming-functionName]
+  const auto days = make_base(7, 1);
+  const auto hours = make_base(24, 100);
+  const auto expected = expected_zip(days, hours, 3);
+
+  const auto rng = ring_zip(std::size_t{3}, days, hours);
+  CHECK(rng.period() == 168);
+
+  const auto hours_list = std::list<int>(hours.begin(), hours.end());
+  const auto list_rng = ring_zip(std::size_t{3}, days, hours_list);
+
+  for (auto step : {0, 1, 6, 23, 24, 167, 168, 300, 503}) {
+    CHECK(*rng.iterator_at(step) == expected[static_cast<std::size_t>(step)]);
+    CHECK(*list_rng.iterator_at(step) == expected[static_cast<std::size_t>(step)]);
+    CHECK(list_rng.iterator_at(step).step() == step);
+    CHECK(rng.begin()[step] == expected[static_cast<std::size_t>(step)]);
+  }
+
+  auto iter = rng.begin() + 400;
+  iter -= 399;
+  CHECK(*iter == expected[1]);
+  --iter;
+  --iter;
+  CHECK(*iter == expected[167]);
+  CHECK(iter - rng.begin() == -1);
+
+  // Seeking and stepping agree
+  auto walk = list_rng.begin();
+  std::ranges::advance(walk, 250);
+  CHECK(walk == list_rng.iterator_at(250));
+  CHECK(*walk == *list_rng.iterator_at(250));
+}
+
+TEST_CASE("ring_zip unbounded", "[ring_zip]") {  // cppcheck-suppress[naming-functionName]
+  auto lhs = std::vector{1, 2, 3};
+  const auto rhs = std::string("ab");
+
+  auto rng = ring_zip(lhs, rhs);
+  CHECK(to_vector(rng | std::views::take(7))
+        == std::vector<std::tuple<int, char>>{
+            {1, 'a'}, {2, 'b'}, {3, 'a'}, {1, 'b'}, {2, 'a'}, {3, 'b'}, {1, 'a'}});
+  CHECK(rng.period() == 6);
+  CHECK(*rng.iterator_at(1'000'001) == std::tuple{3, 'b'});
+
+  std::get<0>(rng.begin()[4]) = 20;
+  CHECK(lhs == std::vector{1, 20, 3});
+
+  auto three = ring_zip_view(lhs, rhs, std::vector{7, 8, 9, 10});
+  CHECK(three.period() == 12);
+  CHECK(*three.iterator_at(11) == std::tuple{3, 'b', 10});
+}
+
+TEST_CASE("ring_zip edge cases", "[ring_zip]") {  // cppcheck-suppress[naming-functionName]
+  const auto base = std::vector{1, 2, 3};
+  const auto empty = std::vector<int>();
+
+  CHECK(std::ranges::empty(ring_zip(std::size_t{5}, base, empty)));
+  CHECK(ring_zip(std::size_t{5}, base, empty).period() == 0);
+
+  SECTION("unbounded over an empty base") {
+    auto rng = ring_zip(base, empty);
+    CHECK(rng.begin() == rng.end());
+    CHECK(rng.end() == rng.begin());
+    CHECK(rng.empty());
+    CHECK(to_vector(rng).empty());
+    CHECK(to_vector(ring_zip(empty, base)).empty());
+
+    const auto list = std::forward_list<int>();
+    CHECK(to_vector(ring_zip(base, list)).empty());
+
+    // Any other bases never end
+    CHECK_FALSE(ring_zip(base, base).empty());
+  }
+
+  auto default_rng = ring_zip_view<std::size_t, std::ranges::owning_view<std::vector<int>>>();
+  CHECK(std::ranges::empty(default_rng));
+
+  CHECK_THROWS_AS(ring_zip(std::numeric_limits<std::size_t>::max(), base, base),
+                  std::overflow_error);
+}
+// NOLINTEND
@@ -0,0 +1,147 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <dlgr/rolling_histogram.h>
+
+namespace {
+
+using histogram_type = dlgr::rolling_histogram<>;
+using std::chrono::seconds;
+
+// Exact quantile by sorting, as rolling_histogram defines it
+auto sorted_quantile(std::vector<std::uint64_t> values, double fraction) -> std::uint64_t {
+  std::ranges::sort(values);
+  const auto rank = std::max(
+      static_cast<std::size_t>(std::ceil(fraction * static_cast<double>(values.size()))),
+      std::size_t{1});
+  return values[rank - 1];
+}
+
+}  // namespace
+
+// NOLINTBEGIN
+TEST_CASE("rolling_histogram quantiles", "[rolling_histogram]") {  // cppcheck-suppress[naming-functionName]
+  const auto start = histogram_type::time_point_type();
+  auto histogram = histogram_type(seconds(1), 4, start);
+  CHECK(histogram.count() == 0);
+  CHECK(histogram.quantile(0.5) == 0);
+
+  SECTION("small values are exact") {
+    for (auto value = std::uint64_t{1}; value <= 100; ++value) {
+      histogram.record(value);
+    }
+    CHECK(histogram.count() == 100);
+    CHECK(histogram.quantile(0.0) == 1);
+    CHECK(histogram.quantile(0.5) == 50);
+    CHECK(histogram.quantile(0.99) == 99);
+    CHECK(histogram.quantile(1.0) == 100);
+  }
+
+  SECTION("large values are within the relative error") {
+    auto gen = std::mt19937_64(42);
+    auto dist = std::lognormal_distribution<double>(10.0, 2.0);
+    auto values = std::vector<std::uint64_t>();
+    for (auto idx = 0; idx < 10'000; ++idx) {
+      values.push_back(static_cast<std::uint64_t>(dist(gen)));
+      histogram.record(values.back());
+    }
+
+    const auto fractions = std::array{0.5, 0.9, 0.99, 0.999};
+    auto reported = std::array<std::uint64_t, fractions.size()>{};
+    histogram.quantiles(fractions, reported);
+    for (auto idx = std::size_t{0}; idx < fractions.size(); ++idx) {
+      const auto exact = static_cast<double>(sorted_quantile(values, fractions[idx]));
+      CHECK(static_cast<double>(reported[idx]) >= exact);
+      CHECK(static_cast<double>(reported[idx]) <= exact * (1 + histogram_type::relative_error));
+      CHECK(histogram.quantile(fractions[idx]) == reported[idx]);
+    }
+  }
+
+  SECTION("record with count") {
+    histogram.record(10, 99);
+    histogram.record(1'000);
+    CHECK(histogram.count() == 100);
+    CHECK(histogram.quantile(0.99) == 10);
+    CHECK(histogram.quantile(0.999) >= 1'000);
+  }
+}
+
+TEST_CASE("rolling_histogram window", "[rolling_histogram]") {  // cppcheck-suppress[naming-functionName]
+  const auto start = histogram_type::time_point_type();
+
+  SECTION("buckets expire") {
+    auto histogram = histogram_type(seconds(1), 3, start);
+
+    // One value per second: 1, 2, 3, ...
+    for (auto second = 0; second < 10; ++second) {
+      histogram.advance(start + seconds(second));
+      histogram.record(static_cast<std::uint64_t>(second + 1));
+
+      const auto expected = static_cast<std::uint64_t>(std::min(second + 1, 3));
+      CHECK(histogram.count() == expected);
+      CHECK(histogram.quantile(0.0) == static_cast<std::uint64_t>(second + 2) - expected);
+      CHECK(histogram.quantile(1.0) == static_cast<std::uint64_t>(second + 1));
+    }
+
+    // Within a bucket nothing moves
+    histogram.advance(start + seconds(9) + std::chrono::milliseconds(999));
+    CHECK(histogram.count() == 3);
+
+    // Past the whole window everything is gone
+    histogram.advance(start + seconds(100));
+    CHECK(histogram.count() == 0);
+    histogram.record(5);
+    histogram.advance(start + seconds(101));
+    CHECK(histogram.count() == 1);
+  }
+
+  SECTION("two buckets") {
+    auto histogram = histogram_type(seconds(1), 2, start);
+    for (auto round = 0; round < 5; ++round) {
+      histogram.record(7);
+      histogram.rotate();
+      CHECK(histogram.count() == 1);
+    }
+    histogram.rotate();
+    CHECK(histogram.count() == 0);
+  }
+}
+
+TEST_CASE("rolling_histogram threads", "[rolling_histogram]") {  // cppcheck-suppress[naming-functionName]
+  constexpr auto threads_count = 4;
+  constexpr auto per_thread = std::uint64_t{10'000};
+  auto histogram = histogram_type(seconds(1), 8);
+
+  auto threads = std::vector<std::thread>();
+  for (auto id = 0; id < threads_count; ++id) {
+    threads.emplace_back([&histogram] {
+      for (auto value = std::uint64_t{0}; value < per_thread; ++value) {
+        histogram.record(value);
+      }
+    });
+  }
+
+  // The reporter keeps rotating while they record, no value falls out of an 8 bucket window
+  for (auto rotation = 0; rotation < 6; ++rotation) {
+    histogram.rotate();
+    std::this_thread::yield();
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  CHECK(histogram.count() == threads_count * per_thread);
+  CHECK(histogram.quantile(1.0) >= per_thread - 1);
+}
+// NOLINTEND
@@ -0,0 +1,150 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <array>
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <dlgr/round_robin.h>
+
+namespace {
+
+template <std::ranges::range RangeType>
+auto to_vector(RangeType&& range) {
+  using ValueType = std::ranges::range_value_t<RangeType>;
+  auto out = std::vector<ValueType>();
+  std::ranges::copy(std::forward<RangeType>(range), std::back_insert_iterator(out));
+  return out;
+}
+
+}  // namespace
+
+// NOLINTBEGIN
+TEST_CASE("round_robin single thread", "[round_robin]") {  // cppcheck-suppress[naming-functionName]
+  const auto backends = std::vector<std::string>{"a", "b", "c"};
+  auto dispenser = dlgr::round_robin(backends);
+
+  CHECK(dispenser.size() == 3);
+
+  auto order = std::vector<std::string>();
+  for (auto turn = 0; turn < 7; ++turn) {
+    order.push_back(dispenser.next());
+  }
+  CHECK(order == std::vector<std::string>{"a", "b", "c", "a", "b", "c", "a"});
+
+  SECTION("batch") {
+    CHECK(to_vector(dispenser.next_batch(5)) == std::vector<std::string>{"b", "c", "a", "b", "c"});
+    CHECK(dispenser.next() == "a");
+    CHECK(std::ranges::empty(dispenser.next_batch(0)));
+    CHECK(dispenser.turns() == 13);
+  }
+
+  SECTION("elements are not copied") {
+    CHECK(&dispenser.next() == &backends[1]);
+  }
+}
+
+TEST_CASE("round_robin owning base", "[round_robin]") {  // cppcheck-suppress[naming-functionName]
+  auto dispenser = dlgr::round_robin(std::vector{1, 2, 4, 8, 16, 32, 64});
+
+  auto sum = 0;
+  for (auto turn = 0; turn < 14; ++turn) {
+    sum += dispenser.next();
+  }
+  CHECK(sum == 2 * 127);
+}
+
+TEST_CASE("round_robin threads", "[round_robin]") {  // cppcheck-suppress[naming-functionName]
+  constexpr auto n_threads = std::size_t{4};
+  constexpr auto per_thread = std::size_t{3'000};
+
+  const auto backends = std::array{0, 1, 2, 3, 4};
+  auto dispenser = dlgr::round_robin(backends);
+
+  auto counts = std::array<std::array<std::size_t, backends.size()>, n_threads>{};
+  {
+    auto threads = std::vector<std::jthread>();
+    for (auto thread = std::size_t{0}; thread < n_threads; ++thread) {
+      threads.emplace_back([&, thread] {
+        for (auto turn = std::size_t{0}; turn < per_thread; turn += 3) {
+          ++counts[thread][static_cast<std::size_t>(dispenser.next())];
+          for (auto backend : dispenser.next_batch(2)) {
+            ++counts[thread][static_cast<std::size_t>(backend)];
+          }
+        }
+      });
+    }
+  }
+
+  // Every turn is taken exactly once, so every backend gets the same share
+  for (auto backend = std::size_t{0}; backend < backends.size(); ++backend) {
+    auto total = std::size_t{0};
+    for (const auto& thread_counts : counts) {
+      total += thread_counts[backend];
+    }
+    CHECK(total == n_threads * per_thread / backends.size());
+  }
+}
+
+TEST_CASE("weighted_round_robin", "[round_robin]") {  // cppcheck-suppress[naming-functionName]
+  const auto backends = std::vector<char>{'a', 'b', 'c'};
+
+  SECTION("smooth order") {
+    const auto weights = std::vector<std::size_t>{5, 1, 1};
+    auto dispenser = dlgr::weighted_round_robin(backends, weights);
+
+    CHECK(dispenser.period() == 7);
+    CHECK(to_vector(dispenser.next_batch(7)) == std::vector{'a', 'a', 'b', 'a', 'c', 'a', 'a'});
+    CHECK(dispenser.next() == 'a');
+    CHECK(dispenser.next() == 'a');
+    CHECK(dispenser.next() == 'b');
+  }
+
+  SECTION("weights are reduced") {
+    const auto weights = std::vector<std::size_t>{40, 20, 0};
+    auto dispenser = dlgr::weighted_round_robin(backends, weights);
+
+    CHECK(dispenser.period() == 3);
+    CHECK(std::ranges::equal(dispenser.schedule(), std::vector<std::size_t>{0, 1, 0}));
+  }
+
+  SECTION("shares") {
+    const auto weights = std::vector<std::size_t>{3, 7, 2};
+    auto dispenser = dlgr::weighted_round_robin(backends, weights);
+
+    auto counts = std::array<std::size_t, 3>{};
+    for (auto turn = 0; turn < 12 * 10; ++turn) {
+      ++counts[static_cast<std::size_t>(dispenser.next() - 'a')];
+    }
+    CHECK(counts == std::array<std::size_t, 3>{30, 70, 20});
+
+    // No element waits longer than its fair gap plus one turn, also across the period end
+    const auto schedule = to_vector(dispenser.schedule());
+    for (auto index = std::size_t{0}; index < weights.size(); ++index) {
+      const auto max_gap = static_cast<std::ptrdiff_t>(12 / weights[index] + 1);
+      auto last = std::ptrdiff_t{-1};
+      auto first = std::ptrdiff_t{-1};
+      for (auto turn = std::ptrdiff_t{0}; turn < std::ssize(schedule); ++turn) {
+        if (schedule[static_cast<std::size_t>(turn)] != index) {
+          continue;
+        }
+        if (last >= 0) {
+          CHECK(turn - last <= max_gap);
+        } else {
+          first = turn;
+        }
+        last = turn;
+      }
+      CHECK(first + std::ssize(schedule) - last <= max_gap);
+    }
+  }
+}
+// NOLINTEND
@@ -0,0 +1,160 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#if defined(__linux__)
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <dlgr/shm_ring.h>
+
+namespace {
+
+// Removes the name when the test is over, whatever happens to the rings
+class shm_name {
+ public:
+  shm_name() : name_("/dlgr_test_shm_ring_" + std::to_string(::getpid())) {}
+
+  shm_name(const shm_name&) = delete;
+  shm_name(shm_name&&) = delete;
+
+  ~shm_name() noexcept { ::shm_unlink(name_.c_str()); }
+
+  auto operator=(const shm_name&) -> shm_name& = delete;
+  auto operator=(shm_name&&) -> shm_name& = delete;
+
+  [[nodiscard]] auto c_str() const noexcept -> const char* { return name_.c_str(); }
+
+ private:
+  std::string name_;
+};
+
+}  // namespace
+
+// NOLINTBEGIN
+TEST_CASE("shm_ring single thread", "[shm_ring]") {  // cppcheck-suppress[naming-functionName]
+  auto ring = dlgr::shm_ring<int>(3);
+
+  CHECK(ring.capacity() == 4);
+  CHECK(ring.empty());
+  CHECK_FALSE(ring.try_pop().has_value());
+
+  for (auto lap = 0; lap < 3; ++lap) {
+    for (auto val = 0; val < 4; ++val) {
+      CHECK(ring.try_push(lap * 10 + val));
+    }
+    CHECK_FALSE(ring.try_push(-1));
+    CHECK(ring.size() == 4);
+
+    for (auto val = 0; val < 4; ++val) {
+      CHECK(ring.try_pop() == lap * 10 + val);
+    }
+    CHECK(ring.empty());
+  }
+}
+
+TEST_CASE("shm_ring bulk", "[shm_ring]") {  // cppcheck-suppress[naming-functionName]
+  auto ring = dlgr::shm_ring<int>(8);
+  const auto values = std::array{1, 2, 3, 4, 5, 6};
+
+  CHECK(ring.push_bulk(values) == 6);
+  CHECK(ring.push_bulk(values) == 2);
+
+  auto out = std::array<int, 5>{};
+  CHECK(ring.pop_bulk(out) == 5);
+  CHECK(out == std::array{1, 2, 3, 4, 5});
+
+  CHECK(ring.push_bulk(values) == 5);
+  CHECK(ring.size() == 8);
+
+  auto rest = std::vector<int>(10);
+  CHECK(ring.pop_bulk(rest) == 8);
+  rest.resize(8);
+  CHECK(rest == std::vector{6, 1, 2, 1, 2, 3, 4, 5});
+  CHECK(ring.pop_bulk(rest) == 0);
+}
+
+TEST_CASE("shm_ring threads", "[shm_ring]") {  // cppcheck-suppress[naming-functionName]
+  constexpr auto count = std::uint64_t{100'000};
+  auto ring = dlgr::shm_ring<std::uint64_t>(16);
+
+  auto producer = std::thread([&] {
+    for (auto val = std::uint64_t{0}; val < count; ++val) {
+      ring.push(val);
+    }
+  });
+
+  auto ordered = true;
+  for (auto val = std::uint64_t{0}; val < count; ++val) {
+    ordered = ordered && ring.pop() == val;
+  }
+  producer.join();
+
+  CHECK(ordered);
+  CHECK(ring.empty());
+}
+
+TEST_CASE("shm_ring fork", "[shm_ring]") {  // cppcheck-suppress[naming-functionName]
+  constexpr auto count = std::uint64_t{100'000};
+  auto requests = dlgr::shm_ring<std::uint64_t>(16);
+  auto replies = dlgr::shm_ring<std::uint64_t>(16);
+
+  const auto child = ::fork();
+  REQUIRE(child >= 0);
+  if (child == 0) {
+    // Echoes every value doubled, the child shares nothing with the parent but the rings
+    for (auto val = std::uint64_t{0}; val < count; ++val) {
+      replies.push(2 * requests.pop());
+    }
+    ::_exit(0);
+  }
+
+  auto ordered = true;
+  for (auto val = std::uint64_t{0}; val < count; ++val) {
+    requests.push(val);
+    ordered = ordered && replies.pop() == 2 * val;
+  }
+
+  auto status = 0;
+  REQUIRE(::waitpid(child, &status, 0) == child);
+  CHECK(WIFEXITED(status));
+  CHECK(WEXITSTATUS(status) == 0);
+  CHECK(ordered);
+}
+
+TEST_CASE("shm_ring named", "[shm_ring]") {  // cppcheck-suppress[naming-functionName]
+  const auto name = shm_name();
+  auto created = dlgr::shm_ring<std::uint64_t>::create(name.c_str(), 5);
+  CHECK(created.capacity() == 8);
+  CHECK_THROWS_AS(dlgr::shm_ring<std::uint64_t>::create(name.c_str(), 5), std::system_error);
+
+  // Another mapping of the same memory, at another address
+  auto opened = dlgr::shm_ring<std::uint64_t>::open(name.c_str());
+  CHECK(opened.capacity() == 8);
+
+  for (auto val = std::uint64_t{0}; val < 20; ++val) {
+    CHECK(created.try_push(val));
+    CHECK(opened.try_pop() == val);
+  }
+  CHECK(opened.try_push(42));
+  CHECK(created.size() == 1);
+
+  CHECK_THROWS_AS(dlgr::shm_ring<std::uint32_t>::open(name.c_str()), std::invalid_argument);
+
+  dlgr::shm_ring<std::uint64_t>::unlink(name.c_str());
+  CHECK_THROWS_AS(dlgr::shm_ring<std::uint64_t>::open(name.c_str()), std::system_error);
+  CHECK(created.try_pop() == 42);
+}
+// NOLINTEND
+
+#endif  // defined(__linux__)
@@ -0,0 +1,121 @@
+// Copyright 2023 Deligor <deligor6321@gmail.com>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <dlgr/spsc_ring.h>
+
+// NOLINTBEGIN
+TEST_CASE("spsc_ring single thread", "[spsc_ring]") {  // cppcheck-suppress[naming-functionName]
+  auto ring = dlgr::spsc_ring<int>(3);
+
+  CHECK(ring.capacity() == 4);
+  CHECK(ring.empty());
+  CHECK_FALSE(ring.try_pop().has_value());
+
+  for (auto lap = 0; lap < 3; ++lap) {
+    for (auto val = 0; val < 4; ++val) {
+      CHECK(ring.try_push(lap * 10 + val));
+    }
+    CHECK_FALSE(ring.try_push(-1));
+    CHECK(ring.size() == 4);
+
+    for (auto val = 0; val < 4; ++val) {
+      CHECK(ring.try_pop() == lap * 10 + val);
+    }
+    CHECK(ring.empty());
+  }
+}
+
+TEST_CASE("spsc_ring bulk", "[spsc_ring]") {  // cppcheck-suppress[naming-functionName]
+  auto ring = dlgr::spsc_ring<int>(8);
+  const auto values = std::array{1, 2, 3, 4, 5, 6};
+
+  CHECK(ring.push_bulk(values) == 6);
+  CHECK(ring.push_bulk(values) == 2);
+
+  auto out = std::array<int, 5>{};
+  CHECK(ring.pop_bulk(out) == 5);
+  CHECK(out == std::array{1, 2, 3, 4, 5});
+
+  CHECK(ring.push_bulk(values) == 5);
+  CHECK(ring.size() == 8);
+
+  auto rest = std::vector<int>(10);
+  CHECK(ring.pop_bulk(rest) == 8);
+  rest.resize(8);
+  CHECK(rest == std::vector{6, 1, 2, 1, 2, 3, 4, 5});
+  CHECK(ring.pop_bulk(rest) == 0);
+}
+
+TEST_CASE("spsc_ring elements lifetime", "[spsc_ring]") {  // cppcheck-suppress[naming-functionName]
+  auto tracker = std::make_shared<int>(0);
+
+  {
+    auto ring = dlgr::spsc_ring<std::shared_ptr<int>>(4);
+    for (auto iter = 0; iter < 3; ++iter) {
+      CHECK(ring.try_push(tracker));
+    }
+    CHECK(tracker.use_count() == 4);
+
+    ring.try_pop();
+    CHECK(tracker.use_count() == 3);
+  }
+
+  CHECK(tracker.use_count() == 1);
+}
+
+TEST_CASE("spsc_ring threads", "[spsc_ring]") {  // cppcheck-suppress[naming-functionName]
+  constexpr auto count = std::size_t{100'000};
+  auto ring = dlgr::spsc_ring<std::size_t>(64);
+
+  SECTION("blocking") {
+    auto producer = std::thread([&] {
+      for (auto val = std::size_t{0}; val < count; ++val) {
+        ring.push(val);
+      }
+    });
+
+    auto ordered = true;
+    for (auto val = std::size_t{0}; val < count; ++val) {
+      ordered = ordered && ring.pop() == val;
+    }
+    producer.join();
+
+    CHECK(ordered);
+    CHECK(ring.empty());
+  }
+
+  SECTION("bulk") {
+    auto producer = std::thread([&] {
+      auto batch = std::array<std::size_t, 16>{};
+      for (auto val = std::size_t{0}; val < count; val += batch.size()) {
+        std::iota(batch.begin(), batch.end(), val);
+        auto pending = std::span<const std::size_t>(batch);
+        while (!pending.empty()) {
+          pending = pending.subspan(ring.push_bulk(pending));
+        }
+      }
+    });
+
+    auto ordered = true;
+    auto expected = std::size_t{0};
+    auto batch = std::array<std::size_t, 7>{};
+    while (expected < count) {
+      const auto popped = ring.pop_bulk(batch);
+      for (auto val : std::span(batch).first(popped)) {
+        ordered = ordered && val == expected++;
+      }
+    }
+    producer.join();
+
+    CHECK(ordered);
+  }
+}
+// NOLINTEND